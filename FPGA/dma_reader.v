@@ -0,0 +1,223 @@
+module dma_reader(
+    input             clock,
+    input             reset,
+
+    // Controle (vindo da FSM do main)
+    input             start,        // pulso: inicia a transferência
+    input             spans,        // 1: a origem é uma lista de trechos (ver abaixo)
+    input             rle,          // 1: a origem está comprimida em RLE (ver abaixo)
+    input      [31:0] src_addr,     // endereço físico do quadro na DDR (alinhado em 32 bytes)
+    input      [16:0] length,       // número de bytes (pixels) a copiar para a mem1
+    output reg        busy,
+    output reg        done,         // pulso de 1 ciclo ao fim da transferência
+
+    // Mestre Avalon-MM (ponte FPGA-HPS, leitura em rajadas)
+    output reg [31:0] avm_address,
+    output reg        avm_read,
+    output reg [3:0]  avm_burstcount,
+    input      [31:0] avm_readdata,
+    input             avm_readdatavalid,
+    input             avm_waitrequest,
+
+    // Porta de escrita da mem1 (palavras de 4 pixels com byteena): uma
+    // palavra por ciclo no modo simples, um pixel por ciclo nos demais
+    output reg [14:0] mem_addr,
+    output reg [31:0] mem_data,
+    output reg [3:0]  mem_be,
+    output reg        mem_wren
+);
+
+    //================================================================
+    // Modo de trechos (spans = 1)
+    //
+    // A origem é uma sequência de trechos, cada um com uma palavra de
+    // cabeçalho seguida dos pixels, completados até múltiplo de 4 bytes:
+    //   cabeçalho[16:0]  = endereço do primeiro pixel na mem1
+    //   cabeçalho[31:17] = número de pixels do trecho (0 a 32767)
+    // length é o tamanho total da lista (múltiplo de 4).
+    //================================================================
+
+    //================================================================
+    // Modo RLE (rle = 1), a partir do endereço 0 da mem1
+    //
+    // Sequência de blocos, cada um começando por um byte de controle c:
+    //   c < 128:  c + 1 pixels literais seguem (1 a 128)
+    //   c >= 128: o próximo byte se repete c - 126 vezes (2 a 129)
+    // length é o tamanho comprimido. Um pixel por ciclo; o byte de
+    // controle custa um ciclo sem escrita.
+    //================================================================
+    localparam RLE_CTRL = 2'd0, RLE_LIT = 2'd1, RLE_VAL = 2'd2, RLE_REP = 2'd3;
+
+    //================================================================
+    // Parâmetros
+    //================================================================
+    localparam BURST      = 4'd8;   // palavras de 32 bits por rajada
+    localparam FIFO_DEPTH = 6'd32;  // palavras
+
+    //================================================================
+    // FIFO de palavras lidas (ainda não escritas na mem1)
+    //================================================================
+    reg [31:0] fifo [0:31];
+    reg [4:0]  fifo_wr_ptr, fifo_rd_ptr;
+
+    reg [14:0] words_total;     // ceil(length / 4)
+    reg [14:0] words_requested; // já pedidas ao barramento
+    reg [14:0] words_consumed;  // já desempacotadas na mem1
+    reg [16:0] bytes_left;
+    reg [1:0]  byte_sel;
+    reg        spans_mode;
+    reg        header_next;     // próxima palavra é um cabeçalho de trecho
+    reg [14:0] span_left;       // pixels restantes no trecho atual
+    reg        rle_mode;
+    reg [1:0]  rle_state;
+    reg [7:0]  rle_count;       // pixels restantes no bloco RLE atual
+    reg [7:0]  rle_value;       // pixel repetido (RLE_REP)
+    reg [16:0] pix_addr;        // endereço (em pixels) da última escrita
+
+    wire [14:0] words_in_flight = words_requested - words_consumed;
+    wire [14:0] words_to_request = words_total - words_requested;
+    reg  [5:0]  fifo_count;
+    wire        fifo_word = (fifo_count != 6'd0) && (bytes_left != 17'd0);
+    wire        is_header = spans_mode && header_next;
+    wire [31:0] head_word = fifo[fifo_rd_ptr];
+    wire        rle_rep   = rle_mode && rle_state == RLE_REP;
+    wire        consume   = fifo_word && !rle_rep; // repetição não lê da FIFO
+    // palavra little-endian: byte 0 é o pixel de menor endereço
+    wire [7:0]  cur_byte  = (byte_sel == 2'd0) ? head_word[7:0] :
+                            (byte_sel == 2'd1) ? head_word[15:8] :
+                            (byte_sel == 2'd2) ? head_word[23:16] : head_word[31:24];
+    // último pixel da palavra: fim da palavra, do quadro ou do trecho (o resto é enchimento)
+    wire        last_byte = (byte_sel == 2'd3) || (bytes_left == 17'd1) ||
+                            (spans_mode && span_left == 15'd1);
+    // modo simples com a palavra inteira por escrever: vai de uma vez
+    wire        whole_word = consume && !spans_mode && !rle_mode && byte_sel == 2'd0 && bytes_left >= 17'd4;
+    wire        pop_word = consume && (is_header || last_byte || whole_word);
+    wire [16:0] next_addr = pix_addr + 1'b1;
+
+    //================================================================
+    // Emissão das rajadas de leitura
+    //================================================================
+    always @(posedge clock) begin
+        if (reset) begin
+            avm_read <= 1'b0;
+        end else if (start && !busy) begin
+            avm_address     <= src_addr;
+            avm_read        <= 1'b0;
+            words_requested <= 15'd0;
+        end else if (avm_read) begin
+            if (!avm_waitrequest) begin
+                avm_read        <= 1'b0;
+                avm_address     <= avm_address + {avm_burstcount, 2'b00};
+                words_requested <= words_requested + avm_burstcount;
+            end
+        end else if (busy && words_to_request != 15'd0 && words_in_flight + BURST <= FIFO_DEPTH) begin
+            // só pede uma nova rajada se a FIFO tem espaço para ela inteira
+            avm_read       <= 1'b1;
+            avm_burstcount <= (words_to_request < BURST) ? words_to_request[3:0] : BURST;
+        end
+    end
+
+    //================================================================
+    // Recepção das palavras e escrita na mem1
+    //================================================================
+    always @(posedge clock) begin
+        done     <= 1'b0;
+        mem_wren <= 1'b0;
+
+        if (reset) begin
+            busy <= 1'b0;
+        end else if (start && !busy) begin
+            busy           <= (length != 17'd0);
+            done           <= (length == 17'd0);
+            words_total    <= (length + 17'd3) >> 2;
+            words_consumed <= 15'd0;
+            bytes_left     <= length;
+            byte_sel       <= 2'd0;
+            spans_mode     <= spans;
+            header_next    <= 1'b1;
+            rle_mode       <= rle;
+            rle_state      <= RLE_CTRL;
+            fifo_wr_ptr    <= 5'd0;
+            fifo_rd_ptr    <= 5'd0;
+            fifo_count     <= 6'd0;
+            pix_addr       <= 17'h1FFFF; // primeiro incremento leva ao endereço 0
+        end else if (busy) begin
+            if (avm_readdatavalid) begin
+                fifo[fifo_wr_ptr] <= avm_readdata;
+                fifo_wr_ptr <= fifo_wr_ptr + 1'b1;
+            end
+
+            if (consume && is_header) begin
+                // cabeçalho: o próximo pixel vai para o endereço do trecho
+                pix_addr    <= head_word[16:0] - 1'b1;
+                span_left   <= head_word[31:17];
+                header_next <= (head_word[31:17] == 15'd0);
+                bytes_left  <= bytes_left - 3'd4;
+                byte_sel    <= 2'd0;
+            end else if (consume && rle_mode && rle_state == RLE_CTRL) begin
+                // byte de controle do RLE: só define o próximo bloco
+                rle_count  <= cur_byte[7] ? cur_byte - 8'd126 : cur_byte + 8'd1;
+                rle_state  <= cur_byte[7] ? RLE_VAL : RLE_LIT;
+                bytes_left <= bytes_left - 1'b1;
+                byte_sel   <= byte_sel + 1'b1;
+            end else if (rle_rep) begin
+                mem_data  <= {4{rle_value}};
+                mem_addr  <= next_addr[16:2];
+                mem_be    <= 4'b0001 << next_addr[1:0];
+                pix_addr  <= next_addr;
+                mem_wren  <= 1'b1;
+                rle_count <= rle_count - 1'b1;
+                if (rle_count == 8'd1) begin
+                    rle_state <= RLE_CTRL;
+                end
+            end else if (whole_word) begin
+                // endereço alinhado: o modo simples começa no 0 e avança de 4 em 4
+                mem_data   <= head_word;
+                mem_addr   <= next_addr[16:2];
+                mem_be     <= 4'b1111;
+                pix_addr   <= pix_addr + 3'd4;
+                mem_wren   <= 1'b1;
+                bytes_left <= bytes_left - 3'd4;
+            end else if (consume) begin
+                mem_data   <= {4{cur_byte}};
+                mem_addr   <= next_addr[16:2];
+                mem_be     <= 4'b0001 << next_addr[1:0];
+                pix_addr   <= next_addr;
+                mem_wren   <= 1'b1;
+                byte_sel   <= byte_sel + 1'b1;
+                span_left  <= span_left - 1'b1;
+
+                if (rle_mode) begin
+                    // literal, ou o primeiro pixel de uma repetição
+                    rle_count <= rle_count - 1'b1;
+                    rle_value <= cur_byte;
+                    rle_state <= (rle_count == 8'd1) ? RLE_CTRL :
+                                 (rle_state == RLE_VAL) ? RLE_REP : RLE_LIT;
+                end
+
+                if (spans_mode && last_byte) begin
+                    // descarta o enchimento da palavra
+                    bytes_left  <= bytes_left - (3'd4 - byte_sel);
+                    byte_sel    <= 2'd0;
+                    header_next <= (span_left == 15'd1);
+                end else begin
+                    bytes_left <= bytes_left - 1'b1;
+                end
+            end
+
+            if (pop_word) begin
+                fifo_rd_ptr    <= fifo_rd_ptr + 1'b1;
+                words_consumed <= words_consumed + 1'b1;
+            end
+
+            // ocupação da FIFO: +1 na chegada, -1 quando a palavra é esvaziada
+            fifo_count <= fifo_count + avm_readdatavalid - pop_word;
+
+            if (bytes_left == 17'd0 && !rle_rep) begin
+                busy <= 1'b0;
+                done <= 1'b1;
+            end
+        end
+    end
+
+endmodule
@@ -323,19 +323,74 @@ soc_system u0 (
 	      			
 	 .pio_instruction_export (instruction), 			// 	pio_instruction_external_connection.export
 	 .pio_enable_export (enable),     			//    pio_enable_external_connection.export
-	 .pio_flags_export (flags)     				//    pio_flags_external_connection.export
+	 .pio_flags_export (flags),     				//    pio_flags_external_connection.export
+	 .pio_data_export (data_packed),     			//    pio_data_external_connection.export
+	 .pio_data_out_export (data_out),     			//    pio_data_out_external_connection.export
+	 .pio_perf_sel_export (perf_sel),     			//    pio_perf_sel_external_connection.export
+	 .pio_perf_export (perf_data),     			//    pio_perf_external_connection.export
+
+	 .vram_clk_clk (clk_100),                    //                       vram_clk.clk
+	 .vram_address (vram_address),               //                           vram.address
+	 .vram_write (vram_write),                   //                               .write
+	 .vram_writedata (vram_writedata),           //                               .writedata
+	 .vram_read (vram_read),                     //                               .read
+	 .vram_readdata (vram_readdata),             //                               .readdata
+	 .vram_readdatavalid (vram_readdatavalid),   //                               .readdatavalid
+	 .vram_waitrequest (vram_waitrequest),       //                               .waitrequest
+	 .vram_byteenable (vram_byteenable),         //                               .byteenable
+	 .vram_burstcount (),                        //                               .burstcount
+	 .vram_debugaccess (),                       //                               .debugaccess
+
+	 .dma_clk_clk (clk_100),                     //                        dma_clk.clk
+	 .dma_address (dma_address),                 //                            dma.address
+	 .dma_read (dma_read),                       //                               .read
+	 .dma_burstcount (dma_burstcount),           //                               .burstcount
+	 .dma_readdata (dma_readdata),               //                               .readdata
+	 .dma_readdatavalid (dma_readdatavalid),     //                               .readdatavalid
+	 .dma_waitrequest (dma_waitrequest),         //                               .waitrequest
+	 .dma_write (1'b0),                          //                               .write
+	 .dma_writedata (32'b0),                     //                               .writedata
+	 .dma_byteenable (4'b1111),                  //                               .byteenable
+	 .dma_debugaccess (1'b0)                     //                               .debugaccess
 );
 
-wire [28:0] instruction;
+wire [31:0] instruction;
+wire [31:0] data_packed;
+wire [7:0] data_out;
+wire [7:0] perf_sel;
+wire [31:0] perf_data;
 wire enable;
 wire [3:0] flags;
 
+// JANELA VRAM (PONTE HPS-FPGA AXI -> mem1 E BUFFERS DE EXIBIÇÃO), NO DOMÍNIO DO clk_100 DO main
+// BITS [18:17] DO ENDEREÇO SELECIONAM A MEMÓRIA (0 = mem1, 1 = BUFFER DE TRÁS / MEM_WORK,
+// 2 = BUFFER DA FRENTE / MEM_DISPLAY), SEJA QUAL FOR A MEMÓRIA FÍSICA (mem2..mem5) NO MOMENTO
+wire        clk_100;
+wire [18:0] vram_address;
+wire        vram_write;
+wire [31:0] vram_writedata;
+wire [3:0]  vram_byteenable;
+wire        vram_read;
+wire [31:0] vram_readdata;
+wire        vram_readdatavalid;
+wire        vram_waitrequest;
+
+// MESTRE DMA (main -> PONTE FPGA-HPS -> DDR), TAMBÉM NO clk_100
+wire [31:0] dma_address;
+wire        dma_read;
+wire [3:0]  dma_burstcount;
+wire [31:0] dma_readdata;
+wire        dma_readdatavalid;
+wire        dma_waitrequest;
+
 // INSTRUCTION DECODE
 
 wire [2:0] opcode = instruction[2:0];
-wire [16:0] mem_addr = (opcode == 3'b010) ? instruction [19:3] : 17'b0; // GARANTE QUE OS BITS SEJAM 0, CASO NÃO SEJA UMA INSTRUÇÃO DE STR
+wire [2:0] ext_op = instruction[31:29]; // MODIFICADOR DA INSTRUÇÃO (EX: STORE EMPACOTADO)
+wire param_op = (opcode == 3'b000 && ext_op != 3'b000 && ext_op != 3'b101); // REFRESH + EXT_CACHE/EXT_LEVEL/EXT_CENTER/EXT_SCALE: O CAMPO DE ENDEREÇO LEVA O PARÂMETRO
+wire [16:0] mem_addr = (opcode == 3'b010 || opcode == 3'b001 || param_op) ? instruction [19:3] : 17'b0; // GARANTE QUE OS BITS SEJAM 0, CASO NÃO SEJA UMA INSTRUÇÃO DE STR, LDR OU DE PARÂMETRO DO ZOOM
 wire [7:0] data = (opcode == 3'b010 || opcode == 3'b001) ? instruction [28:21] : 8'b0; // GARANTE QUE OS BITS SEJAM 0, CASO NÃO SEJA UMA INSTRUÇÃO DE STR ou LDR
-wire sel_mem = 1'b0;
+wire sel_mem = (opcode == 3'b001) ? instruction[20] : 1'b0; // SÓ O LDR ESCOLHE A MEMÓRIA (0 = mem1, 1 = BUFFER DE TRÁS / MEM_WORK)
 
 
 main main_inst (
@@ -345,7 +400,30 @@ main main_inst (
 	.ENABLE(enable),
 	.SEL_MEM(sel_mem),
 	.MEM_ADDR(mem_addr),
+	.EXT_OP(ext_op),
+	.DATA_PACKED(data_packed),
+
+	.CLK_100(clk_100),
+	.VRAM_ADDRESS(vram_address),
+	.VRAM_WRITE(vram_write),
+	.VRAM_WRITEDATA(vram_writedata),
+	.VRAM_BYTEENABLE(vram_byteenable),
+	.VRAM_READ(vram_read),
+	.VRAM_READDATA(vram_readdata),
+	.VRAM_READDATAVALID(vram_readdatavalid),
+	.VRAM_WAITREQUEST(vram_waitrequest),
+
+	.DMA_ADDRESS(dma_address),
+	.DMA_READ(dma_read),
+	.DMA_BURSTCOUNT(dma_burstcount),
+	.DMA_READDATA(dma_readdata),
+	.DMA_READDATAVALID(dma_readdatavalid),
+	.DMA_WAITREQUEST(dma_waitrequest),
+
+	.PERF_SEL(perf_sel[5:0]),
+	.PERF_DATA(perf_data),
 	
+	.DATA_OUT(data_out),
 	.FLAG_DONE(flags[0]),
 	.FLAG_ERROR(flags[1]),
 	.FLAG_ZOOM_MAX(flags[2]),
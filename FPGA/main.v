@@ -6,6 +6,33 @@ module main(
     input [16:0] MEM_ADDR,
     input        SEL_MEM,
     input        ENABLE,
+    input [2:0]  EXT_OP,      // modificador da instrução (bits [31:29] do PIO)
+    input [31:0] DATA_PACKED, // 4 pixels do pio_DATA para o STORE empacotado
+
+    // Janela VRAM na ponte HPS-FPGA (Avalon-MM, domínio do clk_100)
+    // VRAM_ADDRESS[18:17]: 0 = mem1, 1 = buffer de trás, 2 = buffer exibido (escrita só na mem1)
+    output        CLK_100,
+    // (ponte de 32 bits: VRAM_ADDRESS em bytes, alinhado à palavra, e byteenable)
+    input  [18:0] VRAM_ADDRESS,
+    input         VRAM_WRITE,
+    input  [31:0] VRAM_WRITEDATA,
+    input  [3:0]  VRAM_BYTEENABLE,
+    input         VRAM_READ,
+    output [31:0] VRAM_READDATA,
+    output reg    VRAM_READDATAVALID,
+    output        VRAM_WAITREQUEST,
+
+    // Mestre DMA na ponte FPGA-HPS (leitura do quadro direto da DDR)
+    output [31:0] DMA_ADDRESS,
+    output        DMA_READ,
+    output [3:0]  DMA_BURSTCOUNT,
+    input  [31:0] DMA_READDATA,
+    input         DMA_READDATAVALID,
+    input         DMA_WAITREQUEST,
+
+    // Contadores de desempenho (PIOs PERF_SEL/PERF, ver perf_counters.v)
+    input  [5:0]  PERF_SEL,
+    output [31:0] PERF_DATA,
 
     // Portas de Saída e Debug
     output reg [7:0] DATA_OUT,
@@ -33,14 +60,24 @@ module main(
         .outclk_0(clk_100), 
         .outclk_1(clk_25_vga)
     );
+    assign CLK_100 = clk_100;
 
     localparam REFRESH_SCREEN = 3'b000, LOAD = 3'b001, STORE = 3'b010, NHI_ALG = 3'b011;  //Instruções
     localparam PR_ALG = 3'b100, BA_ALG = 3'b101, NH_ALG = 3'b110, RESET_INST = 3'b111;  //instruções
-    localparam IDLE = 3'b00, READ_AND_WRITE = 3'b001, ALGORITHM = 3'b010, RESET = 3'b011, COPY_READ = 3'b100, COPY_WRITE = 3'b101, WAIT_WR_OR_RD = 3'b111; // estados
+    localparam EXT_NONE = 3'b000, EXT_PACKED = 3'b001, EXT_DMA = 3'b010, EXT_SPANS = 3'b011, EXT_RLE = 3'b100; // modificadores (EXT_OP)
+    localparam EXT_VSYNC = 3'b101; // REFRESH_SCREEN: copia para o buffer de trás e troca no próximo vsync
+    localparam EXT_SCAN  = 3'b110; // algoritmos: NHI/PR/NH aplicados na varredura do VGA, sem recalcular
+    localparam EXT_SCALE = 3'b111; // REFRESH_SCREEN: reamostra a mem1 no fator MEM_ADDR[15:0] (8.8)
+    localparam EXT_BILINEAR = 3'b111; // NHI_ALG: zoom in com interpolação bilinear no lugar da replicação
+    localparam EXT_CENTER = 3'b110; // REFRESH_SCREEN: só grava o centro do zoom, MEM_ADDR = {y[7:0], x[8:0]}
+    localparam EXT_LEVEL  = 3'b100; // REFRESH_SCREEN: vai direto ao nível MEM_ADDR[2:0], MEM_ADDR = {scan, alg[1:0], nível}
+    localparam EXT_CACHE  = 3'b001; // REFRESH_SCREEN: liga (MEM_ADDR[0] = 1) ou desliga o cache de níveis
+    localparam IDLE = 3'b00, READ_AND_WRITE = 3'b001, ALGORITHM = 3'b010, RESET = 3'b011, COPY_READ = 3'b100, STREAM = 3'b101, DMA_WAIT = 3'b110, WAIT_WR_OR_RD = 3'b111; // estados
 
     // --- Sinais de Controle da FSM ---
     reg [2:0] uc_state;
     reg [2:0] last_instruction;
+    reg [2:0] last_ext;
 
     // --- Lógica de Gatilho ---
     reg  enable_ff;
@@ -53,58 +90,346 @@ module main(
     reg [16:0] addr_from_vga;
     reg        inside_box;
 
+    // --- Buffers de exibição (mem2..mem5) ---
+    // front_buf escolhe a memória varrida pelo VGA; a de trás (back_buf)
+    // recebe o resultado dos algoritmos e as cópias da mem1, e ao fim de
+    // cada comando os papéis se invertem: não há cópia para a tela. No
+    // REFRESH_SCREEN + EXT_VSYNC a troca espera o início do pulso de vsync,
+    // fora da área visível (sem tearing); nos demais ela é imediata.
+    // Sem o cache de níveis só a mem2 e a mem3 são usadas, em ping-pong.
+    reg  [1:0] front_buf;
+    reg  [1:0] back_buf;
+    reg  swap_pending;  // quadro pronto no buffer de trás, esperando o vsync
+    reg  flip_on_vsync; // a cópia em curso é de um REFRESH_SCREEN + EXT_VSYNC
+    reg  flip_now;      // troca no próximo ciclo (depois da última escrita)
+
+    // --- Zoom na varredura (EXT_SCAN) ---
+    // Com scan_on, o VGA lê o buffer da frente (a imagem em 1x) pelo
+    // endereço remapeado para disp_zoom: zoom in a partir da origem
+    // (pan_x, pan_y) na mem1, decimação com a imagem reduzida em
+    // (pan_x, pan_y) na tela. Trocar de nível ou de centro é só trocar
+    // esses registradores; vale a partir do quadro seguinte.
+    // A média de blocos continua calculada no buffer de trás.
+    reg        scan_on;
+    reg  [2:0] disp_zoom;
+    reg  [8:0] pan_x;
+    reg  [7:0] pan_y;
+    reg        front_base;  // a frente tem a cópia em 1x da mem1 (última cópia, sem algoritmo)
+    reg        base_dirty;  // a mem1 foi escrita depois da última cópia
+
+    // --- Cache de níveis (EXT_CACHE) ---
+    // Cada buffer de exibição guarda a chave do quadro que tem (nível,
+    // algoritmo, vista ou centro e fator). Com cache_on, um algoritmo cuja
+    // chave já está num buffer só troca a frente para ele (acerto); nas
+    // falhas o resultado vai para um buffer livre ou o usado há mais tempo,
+    // sem apagar a frente. Qualquer escrita na mem1 invalida todos.
+    // São 2 buffers (mem2/mem3) por padrão: com a mem1, 3 x 76 M10K. Os 4
+    // (mem4/mem5 a mais) precisam de ZOOM_CACHE_4BUF nas macros do projeto
+    // (VERILOG_MACRO no .qsf) e de 152 M10K livres: não cabem no 5CSEMA5
+    // junto com o resto do projeto.
+`ifdef ZOOM_CACHE_4BUF
+    localparam N_BUFS = 4;
+`else
+    localparam N_BUFS = 2;
+`endif
+    reg         cache_on;
+    reg  [3:0]  tag_valid;
+    reg  [37:0] tag_key [0:3];
+    reg  [1:0]  buf_age [0:3];  // 0: frente, N_BUFS-1: usado há mais tempo
+    reg         fill_dirty;     // a mem1 foi escrita durante o preenchimento
+    reg         cache_hit_p, cache_miss_p;  // pulsos para o perf_counters.v
+
+    // --- Centro do zoom (EXT_CENTER; o RESET volta a (160,120)) ---
+    // Todos os algoritmos partem da vista (view_x, view_y) de next_zoom:
+    //  - zoom in: canto da janela de origem na mem1, recortado para a
+    //    janela não sair da imagem (par no 2x, onde o zoom_stream.v lê
+    //    dois pixels da mesma palavra);
+    //  - zoom out: canto da imagem reduzida na tela, com o centro no meio
+    //    da tela (múltiplo de 4 em x, palavras inteiras no
+    //    zoom_out_stream.v); a imagem reduzida nunca sai da tela;
+    //  - 1x: (0, 0).
+    reg  [8:0] center_x;
+    reg  [7:0] center_y;
+    reg        pan_load;    // recalcula pan_x/pan_y com o novo centro
+    reg  [8:0] view_x;
+    reg  [7:0] view_y;
+
+    initial begin
+        center_x = 9'd160;  // valor de configuração: o zoom parte do centro
+        center_y = 8'd120;
+        pan_load = 1'b0;
+        current_zoom = 3'b100; // 1x desde a partida, como depois do RESET
+        next_zoom    = 3'b100;
+        front_buf = 2'd0;
+        back_buf  = 2'd1;
+        cache_on  = 1'b0;
+        tag_valid = 4'b0000;
+        buf_age[0] = 2'd0;
+        buf_age[1] = 2'd1;
+        buf_age[2] = 2'd2;
+        buf_age[3] = 2'd3;
+    end
+
+    always @(*) begin
+        case (next_zoom)
+            3'b101: begin   // 2x: janela de 160 x 120
+                view_x = (center_x < 9'd80) ? 9'd0 : (center_x > 9'd240) ? 9'd160 : (center_x - 9'd80) & 9'h1FE;
+                view_y = (center_y < 8'd60) ? 8'd0 : (center_y > 8'd180) ? 8'd120 : center_y - 8'd60;
+            end
+            3'b110: begin   // 4x: 80 x 60
+                view_x = (center_x < 9'd40) ? 9'd0 : (center_x > 9'd280) ? 9'd240 : center_x - 9'd40;
+                view_y = (center_y < 8'd30) ? 8'd0 : (center_y > 8'd210) ? 8'd180 : center_y - 8'd30;
+            end
+            3'b111: begin   // 8x: 40 x 30
+                view_x = (center_x < 9'd20) ? 9'd0 : (center_x > 9'd300) ? 9'd280 : center_x - 9'd20;
+                view_y = (center_y < 8'd15) ? 8'd0 : (center_y > 8'd225) ? 8'd210 : center_y - 8'd15;
+            end
+            3'b011: begin   // 1/2: a imagem ocupa 160 x 120
+                view_x = (9'd160 - (center_x >> 1)) & 9'h1FC;
+                view_y = 8'd120 - (center_y >> 1);
+            end
+            3'b010: begin
+                view_x = (9'd160 - (center_x >> 2)) & 9'h1FC;
+                view_y = 8'd120 - (center_y >> 2);
+            end
+            3'b001: begin
+                view_x = (9'd160 - (center_x >> 3)) & 9'h1FC;
+                view_y = 8'd120 - (center_y >> 3);
+            end
+            default: begin
+                view_x = 9'd0;
+                view_y = 8'd0;
+            end
+        endcase
+    end
+
+    // Chave do quadro pedido: {nível, algoritmo, posição, fator}. NHI e PR
+    // dão o mesmo zoom in; a volta ao 1x é a cópia da mem1
+    localparam [37:0] KEY_1X = {3'b100, 35'd0};
+    wire [1:0]  key_alg   = (last_instruction == BA_ALG) ? 2'd1 : (last_ext == EXT_BILINEAR && last_instruction == NHI_ALG) ? 2'd2 : 2'd0;
+    wire [37:0] cache_key = (last_instruction == REFRESH_SCREEN && last_ext == EXT_SCALE) ? {next_zoom, 2'd3, center_x, center_y, scale_q8} :
+                            (last_instruction == RESET_INST) ? KEY_1X : {next_zoom, key_alg, view_x, view_y, 16'd0};
+
+    reg        cache_hit;
+    reg  [1:0] hit_buf;
+    reg  [1:0] victim;
+    integer    k, j;
+
+    always @(*) begin
+        cache_hit = 1'b0;
+        hit_buf   = front_buf;
+        victim    = back_buf;
+        for (k = 0; k < N_BUFS; k = k + 1) begin
+            if (tag_valid[k] && tag_key[k] == cache_key) begin
+                cache_hit = cache_on;
+                hit_buf   = k;
+            end
+            if (k != front_buf && buf_age[k] == N_BUFS - 1) begin
+                victim = k;
+            end
+        end
+        for (k = 0; k < N_BUFS; k = k + 1) begin
+            if (k != front_buf && !tag_valid[k]) begin
+                victim = k;  // buffer livre antes do mais antigo
+            end
+        end
+    end
+
+    reg  [2:0] vsync_sync;
+    wire vsync_pulse = !vsync_sync[1] && vsync_sync[2]; // borda de descida do VGA_V_SYNC_N
+    always @(posedge clk_100) vsync_sync <= {vsync_sync[1:0], VGA_V_SYNC_N};
+
     //================================================================
     // 2. Lógica de Gerenciamento das 3 Memórias
     //================================================================
 
-    reg [16:0] addr_mem2, addr_mem3;
-    wire [16:0] addr_mem1;
-    wire [7:0] data_in_mem3;
-    reg [7:0]  data_in_mem1, data_in_mem2;
-    reg        wren_mem1, wren_mem2;
-    reg wren_mem3;
-    wire [7:0] data_out_mem1, data_out_mem2, data_out_mem3;
+    // Memórias de 32 bits: cada palavra guarda 4 pixels consecutivos (o de
+    // menor endereço no byte 0). Endereço de pixel p: palavra p[16:2], faixa
+    // p[1:0]; escritas de um pixel só usam o byteena da faixa.
+    reg  [14:0] addr_front, addr_back;
+    wire [14:0] addr_mem1;
+    reg  [31:0] data_in_mem1;
+    reg  [3:0]  be_mem1;
+    reg         wren_mem1;
+    reg         wren_back;   // cópia da mem1 (addr_for_write/data_to_write, palavra inteira)
+    wire [31:0] data_out_mem1, data_out_mem2, data_out_mem3, data_out_mem4, data_out_mem5;
     
+    // Escrita pela janela VRAM: usa a porta de escrita da mem1 quando a FSM
+    // e o DMA não estão escrevendo (o host espera no waitrequest)
+    wire        dma_busy, dma_done, dma_wren;
+    wire [14:0] dma_mem_addr;
+    wire [31:0] dma_mem_data;
+    wire [3:0]  dma_mem_be;
+    reg         dma_start;
+    reg         dma_spans;
+    reg         dma_rle;
+
+    // Motores de fluxo dos algoritmos: zoom_stream.v (NHI/PR),
+    // zoom_out_stream.v (NH/BA), zoom_scale_stream.v (fator fracionário,
+    // REFRESH_SCREEN + EXT_SCALE) e zoom_bilinear_stream.v (NHI_ALG +
+    // EXT_BILINEAR) leem a mem1 e escrevem o buffer de trás
+    reg         zoom_start;
+    reg  [15:0] scale_q8;    // fator do último EXT_SCALE, em 8.8
+    wire        scale_alg    = (last_instruction == REFRESH_SCREEN && last_ext == EXT_SCALE);
+    wire        bilinear_alg = (last_instruction == NHI_ALG && last_ext == EXT_BILINEAR);
+    wire        zoom_out_alg = (last_instruction == NH_ALG || last_instruction == BA_ALG);
+    wire        zoom_busy, zoom_done, zoom_wr_en;
+    wire [14:0] zoom_rd_addr, zoom_wr_addr;
+    wire [31:0] zoom_wr_data;
+    wire        zout_busy, zout_done, zout_wr_en;
+    wire [14:0] zout_rd_addr, zout_wr_addr;
+    wire [31:0] zout_wr_data;
+    wire        zsc_busy, zsc_done, zsc_wr_en;
+    wire [14:0] zsc_rd_addr, zsc_wr_addr;
+    wire [31:0] zsc_wr_data;
+    wire        zbl_busy, zbl_done, zbl_wr_en;
+    wire [14:0] zbl_rd_addr, zbl_wr_addr;
+    wire [31:0] zbl_wr_data;
+
+    wire        back_wren    = wren_back || zoom_wr_en || zout_wr_en || zsc_wr_en || zbl_wr_en;
+    wire [14:0] back_wr_addr = zoom_wr_en ? zoom_wr_addr : zout_wr_en ? zout_wr_addr : zsc_wr_en ? zsc_wr_addr :
+                               zbl_wr_en ? zbl_wr_addr : addr_for_write;
+    wire [31:0] back_wr_data = zoom_wr_en ? zoom_wr_data : zout_wr_en ? zout_wr_data : zsc_wr_en ? zsc_wr_data :
+                               zbl_wr_en ? zbl_wr_data : data_to_write;
+
+    wire [1:0] vram_sel = VRAM_ADDRESS[18:17];
+    wire vram_wr = VRAM_WRITE && vram_sel == 2'd0 && !wren_mem1 && !dma_busy;
+
+    // Leitura pela janela VRAM: rouba a porta de leitura da memória escolhida
+    // mem1/buffer de trás só com a FSM parada; o da frente só fora da área
+    // visível do VGA
+    wire vram_rd_mem1  = VRAM_READ && vram_sel == 2'd0 && uc_state == IDLE && !dma_busy;
+    wire vram_rd_back  = VRAM_READ && vram_sel == 2'd1 && uc_state == IDLE;
+    wire vram_rd_front = VRAM_READ && vram_sel == 2'd2 && !inside_box;
+    wire vram_rd = vram_rd_mem1 || vram_rd_back || vram_rd_front || (VRAM_READ && vram_sel == 2'd3);
+
+    assign VRAM_WAITREQUEST = (VRAM_WRITE && vram_sel == 2'd0 && (wren_mem1 || dma_busy)) ||
+                              (VRAM_READ && !vram_rd);
+
+    // latência de leitura das memórias: 2 ciclos
+    reg       vram_rd_p1;
+    reg [1:0] vram_sel_p1, vram_sel_p2;
+    always @(posedge clk_100) begin
+        vram_rd_p1         <= vram_rd;
+        vram_sel_p1        <= vram_sel;
+        VRAM_READDATAVALID <= vram_rd_p1;
+        vram_sel_p2        <= vram_sel_p1;
+    end
+
+    wire [31:0] data_out_front = (front_buf == 2'd0) ? data_out_mem2 : (front_buf == 2'd1) ? data_out_mem3 :
+                                 (front_buf == 2'd2) ? data_out_mem4 : data_out_mem5;
+    wire [31:0] data_out_back  = (back_buf == 2'd0) ? data_out_mem2 : (back_buf == 2'd1) ? data_out_mem3 :
+                                 (back_buf == 2'd2) ? data_out_mem4 : data_out_mem5;
+
+    assign VRAM_READDATA = (vram_sel_p2 == 2'd0) ? data_out_mem1 :
+                           (vram_sel_p2 == 2'd1) ? data_out_back :
+                           (vram_sel_p2 == 2'd2) ? data_out_front : 32'b0;
+
     //memoria que guarda a imagem original
     mem1 memory1(
         .rdaddress(addr_mem1), 
-        .wraddress(addr_wr_mem1), 
+        .wraddress(dma_wren ? dma_mem_addr : vram_wr ? VRAM_ADDRESS[16:2] : addr_wr_mem1), 
         .clock(clk_100), 
-        .data(data_in_mem1), 
-        .wren(wren_mem1), 
+        .data(dma_wren ? dma_mem_data : vram_wr ? VRAM_WRITEDATA : data_in_mem1), 
+        .byteena_a(dma_wren ? dma_mem_be : vram_wr ? VRAM_BYTEENABLE : be_mem1), 
+        .wren(wren_mem1 || vram_wr || dma_wren), 
         .q(data_out_mem1)
     );
 
-    //memoria de exibiçao
+    //buffers de exibição: a frente é varrida pelo VGA, a de trás é escrita;
+    //mem4 e mem5 só guardam níveis do cache (só com ZOOM_CACHE_4BUF)
     mem1 memory2(
-        .rdaddress(addr_mem2), 
-        .wraddress(addr_wr_mem2), 
+        .rdaddress(front_buf == 2'd0 ? addr_front : addr_back), 
+        .wraddress(back_wr_addr), 
         .clock(clk_100), 
-        .data(data_in_mem2), 
-        .wren(wren_mem2), 
+        .data(back_wr_data), 
+        .byteena_a(4'b1111), 
+        .wren(back_wren && back_buf == 2'd0), 
         .q(data_out_mem2)
     );
-    //memoria de trabalho
     mem1 memory3(
-        .rdaddress(addr_mem3), // <-- Mudança aqui para permitir controle
-        .wraddress(addr_for_write), 
+        .rdaddress(front_buf == 2'd1 ? addr_front : addr_back), 
+        .wraddress(back_wr_addr), 
         .clock(clk_100), 
-        .data(data_to_write), // <-- MUDANÇA PRINCIPAL: Usar o dado do algoritmo
-        .wren(wren_mem3), 
+        .data(back_wr_data), 
+        .byteena_a(4'b1111), 
+        .wren(back_wren && back_buf == 2'd1), 
         .q(data_out_mem3)
     );
+`ifdef ZOOM_CACHE_4BUF
+    mem1 memory4(
+        .rdaddress(front_buf == 2'd2 ? addr_front : addr_back), 
+        .wraddress(back_wr_addr), 
+        .clock(clk_100), 
+        .data(back_wr_data), 
+        .byteena_a(4'b1111), 
+        .wren(back_wren && back_buf == 2'd2), 
+        .q(data_out_mem4)
+    );
+    mem1 memory5(
+        .rdaddress(front_buf == 2'd3 ? addr_front : addr_back), 
+        .wraddress(back_wr_addr), 
+        .clock(clk_100), 
+        .data(back_wr_data), 
+        .byteena_a(4'b1111), 
+        .wren(back_wren && back_buf == 2'd3), 
+        .q(data_out_mem5)
+    );
+`else
+    assign data_out_mem4 = 32'b0;
+    assign data_out_mem5 = 32'b0;
+`endif
 
-    assign addr_mem1 = (uc_state != ALGORITHM && uc_state != WAIT_WR_OR_RD && uc_state != READ_AND_WRITE) ? addr_for_copy: addr_for_read; //teve mudança aqui
+    // cópias (RESET/REFRESH/volta ao 1x) leem a mem1 no counter_address
+    assign addr_mem1 = vram_rd_mem1 ? VRAM_ADDRESS[16:2] :
+                       (uc_state == STREAM) ? (scale_alg ? zsc_rd_addr : bilinear_alg ? zbl_rd_addr :
+                                               zoom_out_alg ? zout_rd_addr : zoom_rd_addr) :
+                       (uc_state == WAIT_WR_OR_RD || uc_state == READ_AND_WRITE) ? addr_for_read[16:2] : counter_address;
 
     //================================================================
     // 3. Lógica do VGA
     //================================================================
+    // parâmetros da varredura, copiados acima da caixa da imagem: uma
+    // mudança no meio do quadro só vale no seguinte
+    reg [2:0] vga_zoom;
+    reg [8:0] vga_pan_x;
+    reg [7:0] vga_pan_y;
+
     always @(posedge clk_25_vga) begin
         localparam X_START=159, Y_START=119, X_END=X_START+320, Y_END=Y_START+240;
         reg [16:0] vga_offset;
-        if (next_x >= (X_START) && next_x <= (X_END) && next_y >= (Y_START) && next_y <= (Y_END )) begin
+        reg [9:0]  vx, vy, sx, sy;
+        reg [1:0]  vs;
+        reg        in_win;
+
+        if (next_y < Y_START) begin
+            vga_zoom  <= scan_on ? disp_zoom : 3'b100;
+            vga_pan_x <= pan_x;
+            vga_pan_y <= pan_y;
+        end
+
+        vx = next_x - X_START;
+        vy = next_y - Y_START;
+        if (vga_zoom > 3'b100) begin
+            // zoom in: fator 2^vs a partir da origem
+            vs = vga_zoom - 3'b100;
+            sx = vga_pan_x + (vx >> vs);
+            sy = vga_pan_y + (vy >> vs);
+            // a caixa abaixo inclui X_END e Y_END: em vx = 320 ou vy = 240 o
+            // sx passaria da linha e o sy chegaria a 240, fora da memória
+            in_win = vx < 10'd320 && vy < 10'd240;
+        end else begin
+            // decimação (vs = 1..3) ou 1x (vs = 0): imagem de (320 >> vs) x (240 >> vs) em (pan_x, pan_y)
+            vs = 3'b100 - vga_zoom;
+            sx = (vx - vga_pan_x) << vs;
+            sy = (vy - vga_pan_y) << vs;
+            in_win = vx >= vga_pan_x && vx < vga_pan_x + (10'd320 >> vs) &&
+                     vy >= vga_pan_y && vy < vga_pan_y + (10'd240 >> vs);
+        end
+
+        if (next_x >= (X_START) && next_x <= (X_END) && next_y >= (Y_START) && next_y <= (Y_END ) && in_win) begin
             inside_box <= 1'b1;
-            vga_offset = (next_y - Y_START) * 320 + (next_x - X_START);
+            vga_offset = sy * 320 + sx;
             addr_from_vga <= vga_offset;
         end else begin
             inside_box <= 1'b0;
@@ -112,39 +437,37 @@ module main(
         end
     end
     
+ 
+    // faixa do pixel do VGA, atrasada junto com a leitura (2 ciclos)
+    reg [1:0] vga_lane_p1, vga_lane_p2;
     reg [7:0] data_to_vga_pipe;
     always @(posedge clk_100) begin
-        data_to_vga_pipe <= (inside_box) ? data_out_mem2:8'b0;
+        vga_lane_p1 <= addr_from_vga[1:0];
+        vga_lane_p2 <= vga_lane_p1;
+        data_to_vga_pipe <= (inside_box) ? data_out_front >> {vga_lane_p2, 3'b000} : 8'b0;
     end 
 
     reg [1:0] counter_rd_wr;
 
-    reg [16:0] counter_address;
+    reg [14:0] counter_address; // palavra
     //================================================================
     // 4. Pipeline de Dados do Algoritmo
     //================================================================
     reg [2:0] next_zoom;
     reg [2:0] current_zoom;
-    
-    reg has_alg_on_exec;
-
-    reg [16:0] addr_wr_mem2;
 
-    reg [16:0] addr_wr_mem1;
-
-    reg [9:0] new_x, new_y;
-    reg [9:0] old_x, old_y;
+    reg [14:0] addr_wr_mem1;
 
     reg [16:0] addr_for_read;
-    reg [16:0] addr_for_write;
+    reg [14:0] addr_for_write;
 
-    reg [7:0] data_to_write;
-    reg [16:0] needed_steps, current_step;
+    reg [31:0] data_to_write;
     reg [3:0] op_step;
 
-    reg [31:0] data_to_avg;
-
-    reg [7:0] data_to_write_mem1;
+    // Cópia da mem1 para o buffer de trás: palavras lidas há 1 e 2 ciclos
+    reg [14:0] copy_addr_p1, copy_addr_p2;
+    reg [1:0]  copy_valid;
+    reg        copy_issued;
 
     assign FLAG_ZOOM_MAX = (current_zoom == 3'b111) ? 1'b1: 1'b0;
     assign FLAG_ZOOM_MIN = (current_zoom == 3'b001) ? 1'b1: 1'b0;
@@ -154,22 +477,68 @@ module main(
     //================================================================
     always @(posedge clk_100) begin
 
+        // troca de buffer: no vsync (EXT_VSYNC) ou logo após o comando.
+        // Nada escreve no buffer de trás com swap_pending em 1
+        cache_hit_p  <= 1'b0;
+        cache_miss_p <= 1'b0;
+        if ((vsync_pulse && swap_pending) || flip_now) begin
+            front_buf    <= back_buf;
+            back_buf     <= front_buf;
+            swap_pending <= 1'b0;
+            flip_now     <= 1'b0;
+            // idade dos buffers desde a última vez na frente
+            for (j = 0; j < N_BUFS; j = j + 1) begin
+                if (j == back_buf) begin
+                    buf_age[j] <= 2'd0;
+                end else if (buf_age[j] < buf_age[back_buf]) begin
+                    buf_age[j] <= buf_age[j] + 1'b1;
+                end
+            end
+        end
+
         case (uc_state) 
             IDLE: begin 
-                has_alg_on_exec     <= 1'b0;
+                // quem termina com flip_now não levanta o DONE: ele sobe aqui,
+                // na mesma borda da troca, e o HPS já lê o quadro novo na frente
                 FLAG_DONE           <= 1'b1;
                 wren_mem1 <= 1'b0;
-                wren_mem2 <= 1'b0;
-                wren_mem3 <= 1'b0;
+                wren_back <= 1'b0;
+                dma_start <= 1'b0;
+                zoom_start <= 1'b0;
+                copy_valid  <= 2'b00;
+                copy_issued <= 1'b0;
+                if (pan_load) begin
+                    pan_load <= 1'b0;
+                    pan_x    <= view_x;
+                    pan_y    <= view_y;
+                end
 
 
                 if (enable_pulse) begin
                     //last_instruction <= INSTRUCTION;
-                    counter_address <= 17'd0;
+                    counter_address <= 15'd0;
                     counter_rd_wr <= 2'b0;
-                    if (INSTRUCTION == LOAD || INSTRUCTION == STORE) begin
+                    flip_on_vsync <= 1'b0;
+                    if (INSTRUCTION == STORE && (EXT_OP == EXT_DMA || EXT_OP == EXT_SPANS || EXT_OP == EXT_RLE)) begin
+                        // DMA: DATA_PACKED = endereço físico, MEM_ADDR = tamanho em bytes
+                        // EXT_SPANS: a origem é uma lista de trechos; EXT_RLE: um quadro
+                        // comprimido (ver dma_reader.v)
+                        if ((EXT_OP == EXT_DMA && MEM_ADDR > 17'd76800) ||
+                            (EXT_OP == EXT_SPANS && MEM_ADDR[1:0] != 2'b00)) begin
+                            FLAG_ERROR <= 1'b1;
+                        end else begin
+                            FLAG_DONE        <= 1'b0;
+                            dma_start        <= 1'b1;
+                            dma_spans        <= (EXT_OP == EXT_SPANS);
+                            dma_rle          <= (EXT_OP == EXT_RLE);
+                            last_instruction <= STORE;
+                            uc_state         <= DMA_WAIT;
+                        end
+                    end else if (INSTRUCTION == LOAD || INSTRUCTION == STORE) begin
                         uc_state         <= READ_AND_WRITE;
                         last_instruction <= INSTRUCTION;
+                        last_ext         <= EXT_OP;
+                        op_step          <= 4'b0;
                     end else if (INSTRUCTION >= NHI_ALG && INSTRUCTION <= NH_ALG) begin
                             case (INSTRUCTION)
                                 NH_ALG:begin
@@ -179,7 +548,7 @@ module main(
                                     end else begin
                                         next_zoom <=  current_zoom - 1'b1;
                                         if (current_zoom == 3'b101) begin
-                                            uc_state <= COPY_READ;
+                                            uc_state <= ALGORITHM;  // a cópia (ou o acerto do cache) sai do ALGORITHM
                                             last_instruction <= RESET_INST;
                                         end
                                         else if (current_zoom <= 3'b100) begin
@@ -200,7 +569,7 @@ module main(
                                     end else begin
                                         next_zoom <= current_zoom + 1'b1;
                                         if (current_zoom == 3'b011) begin
-                                            uc_state <= COPY_READ;
+                                            uc_state <= ALGORITHM;  // a cópia (ou o acerto do cache) sai do ALGORITHM
                                             last_instruction <= RESET_INST;
                                         end
                                         else if (current_zoom >= 3'b100) begin
@@ -221,7 +590,7 @@ module main(
                                     end else begin
                                         next_zoom <=  current_zoom - 1'b1;
                                         if (current_zoom == 3'b101) begin
-                                            uc_state <= COPY_READ;
+                                            uc_state <= ALGORITHM;  // a cópia (ou o acerto do cache) sai do ALGORITHM
                                             last_instruction <= RESET_INST;
                                         end
                                         else if (current_zoom <= 3'b100) begin
@@ -243,7 +612,7 @@ module main(
                                     end else begin
                                         next_zoom <=  current_zoom + 1'b1;
                                         if (current_zoom == 3'b011) begin
-                                            uc_state <= COPY_READ;
+                                            uc_state <= ALGORITHM;  // a cópia (ou o acerto do cache) sai do ALGORITHM
                                             last_instruction <= RESET_INST;
                                         end
                                         else if (current_zoom >= 3'b100) begin
@@ -261,38 +630,122 @@ module main(
 
                             endcase
                             
-                            counter_address <= 17'd0;
+                            counter_address <= 15'd0;
                             counter_rd_wr <= 2'b0;
+                            last_ext <= EXT_OP;
                         
                     end else if (INSTRUCTION == RESET_INST) begin
                         last_instruction <= 3'b111;
+                        last_ext <= EXT_NONE;
                         uc_state <= RESET;
-                        counter_address <= 17'd0;
+                        counter_address <= 15'd0;
                         counter_rd_wr <= 2'b0;
+                    end else if (INSTRUCTION == REFRESH_SCREEN && EXT_OP == EXT_SCALE) begin
+                        // fator de 1/8 (0x0020) a 8x (0x0800); o nível do zoom passa a
+                        // ser o da potência de 2 logo abaixo do fator
+                        if (MEM_ADDR[16] || MEM_ADDR[15:0] < 16'h0020 || MEM_ADDR[15:0] > 16'h0800) begin
+                            FLAG_ERROR <= 1'b1;
+                        end else begin
+                            scale_q8         <= MEM_ADDR[15:0];
+                            next_zoom        <= MEM_ADDR[11] ? 3'b111 : MEM_ADDR[10] ? 3'b110 :
+                                                MEM_ADDR[9]  ? 3'b101 : MEM_ADDR[8]  ? 3'b100 :
+                                                MEM_ADDR[7]  ? 3'b011 : MEM_ADDR[6]  ? 3'b010 : 3'b001;
+                            last_instruction <= REFRESH_SCREEN;
+                            last_ext         <= EXT_SCALE;
+                            FLAG_DONE        <= 1'b0;
+                            uc_state         <= ALGORITHM;
+                        end
+                    end else if (INSTRUCTION == REFRESH_SCREEN && EXT_OP == EXT_LEVEL) begin
+                        // salto direto ao nível: os motores calculam qualquer nível a
+                        // partir da mem1, então basta uma passada (ou a cópia, no 1x).
+                        // alg 0: NHI/NH, 1: PR/BA, 2: bilinear/NH; MEM_ADDR[5]: EXT_SCAN
+                        if (MEM_ADDR[2:0] == 3'b000 || MEM_ADDR[4:3] == 2'b11) begin
+                            FLAG_ERROR <= 1'b1;
+                        end else begin
+                            next_zoom <= MEM_ADDR[2:0];
+                            FLAG_DONE <= 1'b0;
+                            if (MEM_ADDR[2:0] == 3'b100) begin
+                                last_instruction <= RESET_INST;
+                                last_ext         <= MEM_ADDR[5] ? EXT_SCAN : EXT_NONE;
+                                uc_state         <= ALGORITHM;
+                            end else if (MEM_ADDR[2:0] > 3'b100) begin
+                                last_instruction <= (MEM_ADDR[4:3] == 2'b01) ? PR_ALG : NHI_ALG;
+                                last_ext         <= (MEM_ADDR[4:3] == 2'b10) ? EXT_BILINEAR : MEM_ADDR[5] ? EXT_SCAN : EXT_NONE;
+                                uc_state         <= ALGORITHM;
+                            end else begin
+                                last_instruction <= (MEM_ADDR[4:3] == 2'b01) ? BA_ALG : NH_ALG;
+                                last_ext         <= MEM_ADDR[5] ? EXT_SCAN : EXT_NONE;
+                                uc_state         <= ALGORITHM;
+                            end
+                        end
+                    end else if (INSTRUCTION == REFRESH_SCREEN && EXT_OP == EXT_CACHE) begin
+                        // liga/desliga o cache; nos dois casos ele começa vazio
+                        cache_on  <= MEM_ADDR[0];
+                        tag_valid <= 4'b0000;
+                    end else if (INSTRUCTION == REFRESH_SCREEN && EXT_OP == EXT_CENTER) begin
+                        // só o registrador: vale no próximo algoritmo (e já no
+                        // próximo quadro, com o zoom na varredura)
+                        if (MEM_ADDR[8:0] > 9'd319 || MEM_ADDR[16:9] > 8'd239) begin
+                            FLAG_ERROR <= 1'b1;
+                        end else begin
+                            center_x <= MEM_ADDR[8:0];
+                            center_y <= MEM_ADDR[16:9];
+                            pan_load <= 1'b1;
+                        end
                     end else if (INSTRUCTION == REFRESH_SCREEN) begin
                         last_instruction <= 3'b111;
                         uc_state <= COPY_READ;
-                        counter_address <= 17'b0;
+                        counter_address <= 15'd0;
                         counter_rd_wr <= 2'b0;
+                        FLAG_DONE <= 1'b0;
+                        flip_on_vsync <= (EXT_OP == EXT_VSYNC);
+                        last_ext <= EXT_OP;
                     end
                 end
             end
             
             READ_AND_WRITE: begin
-                if (MEM_ADDR > 17'd76799) begin
+                if (MEM_ADDR > 17'd76799 || (last_ext == EXT_PACKED && MEM_ADDR > 17'd76796)) begin
                     FLAG_ERROR <= 1'b1;
                 end
                 FLAG_DONE <= 1'b0;
-                if (last_instruction == STORE) begin
-                    addr_wr_mem1 <= MEM_ADDR;
-                    data_in_mem1 <= DATA_IN;
+                if (last_instruction == STORE && last_ext == EXT_PACKED) begin
+                    // STORE empacotado: os 4 pixels numa escrita, ou duas se
+                    // cruzam a palavra (pixel i vai para a faixa (MEM_ADDR + i) % 4)
+                    if (op_step == 4'd0) begin
+                        addr_wr_mem1 <= MEM_ADDR[16:2];
+                        be_mem1      <= 4'b1111 << MEM_ADDR[1:0];
+                    end else begin
+                        addr_wr_mem1 <= MEM_ADDR[16:2] + 1'b1;
+                        be_mem1      <= 4'b1111 >> (3'd4 - MEM_ADDR[1:0]);
+                    end
+                    case (MEM_ADDR[1:0])
+                        2'd0: data_in_mem1 <= DATA_PACKED;
+                        2'd1: data_in_mem1 <= {DATA_PACKED[23:0], DATA_PACKED[31:24]};
+                        2'd2: data_in_mem1 <= {DATA_PACKED[15:0], DATA_PACKED[31:16]};
+                        2'd3: data_in_mem1 <= {DATA_PACKED[7:0],  DATA_PACKED[31:8]};
+                    endcase
+                    // fora da imagem só levanta o FLAG_ERROR: sem isso os pixels
+                    // que ainda caem na última palavra seriam escritos
+                    wren_mem1 <= (MEM_ADDR <= 17'd76796);
+                    if (op_step != 4'd0 || MEM_ADDR[1:0] == 2'd0) begin
+                        op_step <= 4'd0;
+                        uc_state <= WAIT_WR_OR_RD;
+                        counter_rd_wr <= 2'b00;
+                    end else begin
+                        op_step <= op_step + 1'b1;
+                    end
+                end else if (last_instruction == STORE) begin
+                    addr_wr_mem1 <= MEM_ADDR[16:2];
+                    be_mem1      <= 4'b0001 << MEM_ADDR[1:0];
+                    data_in_mem1 <= {4{DATA_IN}};
                     wren_mem1 <= 1'b1;
                     uc_state <= WAIT_WR_OR_RD;
                     counter_rd_wr <= 2'b00;
                 end else begin
                     if (SEL_MEM) begin
-                        counter_address <= MEM_ADDR;
-                        wren_mem3 <= 1'b0;
+                        counter_address <= MEM_ADDR[16:2];
+                        wren_back <= 1'b0;
                     end else begin
                         addr_for_read <= MEM_ADDR;
                         wren_mem1 <= 1'b0;
@@ -305,472 +758,148 @@ module main(
             ALGORITHM: begin
                 wren_mem1 <= 1'b0;
                 FLAG_DONE <= 1'b0;
-                case (last_instruction)
-                    PR_ALG: begin
-                        if (!has_alg_on_exec) begin
-                            current_step <= 19'd0;
-                            has_alg_on_exec <= 1'b1;
-                            needed_steps <= 19'd19199;
-                            op_step <= 3'b0;
-                            new_x <= 10'b0;
-                            new_y <= 10'b0;
-
-                            if (next_zoom == 3'b101) begin
-                                old_x <= 10'd80;
-                                old_y <= 10'd60;
-                            end else if (next_zoom == 3'b110) begin
-                                old_x <= 10'd120;
-                                old_y <= 10'd90;
-                            end else if (next_zoom == 3'b111) begin
-                                old_x <= 10'd140;
-                                old_y <= 10'd105;
-                            end else begin
-                                old_x <= 10'd0;
-                                old_y <= 10'd0;
-                            end
-
-                        end else begin
-                            if (current_step >= needed_steps) begin
-                                counter_address <= 17'd0;
-                                counter_rd_wr <= 2'b0;
-                                has_alg_on_exec <= 1'b0;
-                                wren_mem3 <= 1'b0;
-                                
-                                uc_state <= COPY_READ;
-
-                            end else begin
-                                if (op_step == 3'b000) begin
-                                    addr_for_read <= old_x + (old_y*10'd320);
-                                    counter_rd_wr <= 2'b0;
-                                    op_step <= 3'b001;
-                                    wren_mem3 <= 1'b0;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                end else if (op_step == 3'b001) begin
-                                    data_to_write <= data_out_mem1;
-                                    counter_rd_wr <= 2'b0;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    wren_mem3 <= 1'b1;
-                                    op_step <= 3'b010;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                    new_x <= new_x + 1'b1;
-                                end else if (op_step == 3'b010) begin
-                                    data_to_write <= data_out_mem1;
-                                    counter_rd_wr <= 2'b0;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    wren_mem3 <= 1'b1;
-                                    op_step <= 3'b011;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                    new_x <= new_x - 1'b1;
-                                    new_y <= new_y + 1'b1;
-                                end else if (op_step == 3'b011) begin
-                                    data_to_write <= data_out_mem1;
-                                    counter_rd_wr <= 2'b0;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    wren_mem3 <= 1'b1;
-                                    op_step <= 3'b100;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                    new_x <= new_x + 1'b1;
-                                end else if (op_step == 3'b100) begin
-                                    data_to_write <= data_out_mem1;
-                                    counter_rd_wr <= 2'b0;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    wren_mem3 <= 1'b1;
-                                    op_step <= 3'b000;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                    if (new_x >= 10'd319) begin
-                                        new_x <= 10'd0;
-                                        new_y <= new_y + 1'b1;
-
-                                        if (next_zoom == 3'b101) begin
-                                            old_x <= 10'd80;
-                                            old_y <= (new_y >> 2'b1) + 10'd60;
-                                        end else if (next_zoom == 3'b110) begin
-                                            old_x <= 10'd120;
-                                            old_y <= (new_y >> 2'd2) + 10'd90;
-                                        end else  if (next_zoom == 3'b111) begin
-                                            old_x <= 10'd140;
-                                            old_y <= (new_y>>2'd3) + 10'd105;
-
-                                        end else begin
-                                            old_x <= new_x;
-                                            old_y <= new_y;
-                                        end
-                                    end else begin
-                                        new_x <= new_x + 1'b1;
-                                        new_y <= new_y - 1'b1;
-                                        if (next_zoom == 3'b101) begin
-                                            old_x <= (new_x >> 1'b1) + 10'd80;
-                                        end else if(next_zoom == 3'b110) begin
-                                            old_x <= (new_x >> 2'd2) + 10'd120;
-                                        end else if (next_zoom == 3'b111) begin
-                                            old_x <= (new_x >> 2'd3) + 10'd140;
-                                        end else begin
-                                            old_x <= new_x;
-                                        end
-                                        current_step <= current_step + 1;
-                                    end
-                                end
-                            end
-                        end
-                    end
-
-                    NHI_ALG: begin
-                        if (!has_alg_on_exec) begin
-                            has_alg_on_exec <= 1'b1;
-                            current_step <= 19'd0;
-                            needed_steps <= 19'd76799;
-                            op_step <= 3'b0;
-                            new_x <= 10'b0;
-                            new_y <= 10'b0;
-
-                            if (next_zoom == 3'b101) begin
-                                old_x <= 10'd80;
-                                old_y <= 10'd60;
-
-                            end else if (next_zoom == 3'b110) begin
-                                old_x <= 10'd120;
-                                old_y <= 10'd90;
-                            end else if (next_zoom == 3'b111) begin
-                                old_x <= 10'd140;
-                                old_y <= 10'd105;
-                            end else begin
-                                old_x <= 10'd0;
-                                old_y <= 10'd0;
-                            end
-
-
-                        end else begin
-                            if (current_step >= needed_steps) begin
-                                counter_address <= 17'd0;
-                                counter_rd_wr <= 2'b0;
-                                has_alg_on_exec <= 1'b0;
-                                wren_mem3 <= 1'b0;
-                                
-                                uc_state <= COPY_READ;
-
-                            end else begin
-                                if (op_step == 3'b000) begin
-                                    addr_for_read <= old_x + (old_y*10'd320);
-                                    counter_rd_wr <= 2'b0;
-                                    op_step <= 3'b001;
-                                    wren_mem3 <= 1'b0;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                end else if (op_step == 3'b001) begin
-                                    current_step <= current_step + 1'b1;
-                                    data_to_write <= data_out_mem1;
-                                    counter_rd_wr <= 2'b0;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    wren_mem3 <= 1'b1;
-                                    op_step <= 3'b000;
-                                    uc_state <= WAIT_WR_OR_RD;
-                                    if (new_x >= 10'd319) begin
-                                        new_x <= 10'd0;
-                                        new_y <= new_y + 1'b1;
-                                        if (next_zoom == 3'b101) begin
-                                            old_x <= 10'd80;
-                                            old_y <= (new_y>>1'b1) + 10'd60;
-                                        end else if (next_zoom == 3'b110) begin
-                                            old_x <= 10'd120;
-                                            old_y <= (new_y>>2'd2) + 10'd90;
-                                        end else if (next_zoom == 3'b111) begin
-                                            old_x <= 10'd140;
-                                            old_y <= (new_y>>2'd3) + 10'd105;
-                                        end else begin
-                                            old_x <= new_x;
-                                            old_y <= new_y;
-                                        end
-                                        
-                                    end else begin
-                                        new_x <= new_x + 1'b1;
-                                        if (next_zoom == 3'b101) begin
-                                            old_x <= (new_x>>1'b1) + 10'd80;
-                                        end else if (next_zoom == 3'b110) begin
-                                            old_x <= (new_x>>2'd2) + 10'd120;
-                                        end else if (next_zoom == 3'b111) begin
-                                            old_x <= (new_x>>2'd3) + 10'd140;
-                                        end else begin
-                                            old_x <= new_x;
-                                        end
-                                    end
-                                end
-                            end
-                        end
-                    
+                if (swap_pending) begin
+                    // o buffer de trás ainda espera o vsync de um REFRESH_SCREEN + EXT_VSYNC
+                end else if (last_ext == EXT_SCAN && last_instruction != BA_ALG) begin
+                    if (front_base && !base_dirty) begin
+                        // a frente já tem a mem1 em 1x: só muda o remapeamento do VGA
+                        scan_on      <= 1'b1;
+                        disp_zoom    <= next_zoom;
+                        pan_x        <= view_x;
+                        pan_y        <= view_y;
+                        current_zoom <= next_zoom;
+                        FLAG_DONE    <= 1'b1;
+                        uc_state     <= IDLE;
+                    end else begin
+                        // copia a mem1 antes; o remapeamento passa a valer na troca
+                        counter_address <= 15'd0;
+                        copy_valid      <= 2'b00;
+                        copy_issued     <= 1'b0;
+                        uc_state        <= COPY_READ;
                     end
-                    BA_ALG: begin
-                        if (!has_alg_on_exec) begin
-                            has_alg_on_exec <= 1'b1;
-                            current_step <= 19'd0;
-                            needed_steps <= 19'd76799;
-                            op_step <= 3'b0;
-                            new_x <= 10'b0;
-                            new_y <= 10'b0;
-                            old_x <= 10'd0;
-                            old_y <= 10'd0;
-                            
-                        end else begin
-                            if (current_step >= needed_steps) begin
-                                counter_address <= 17'd0;
-                                counter_rd_wr <= 2'b0;
-                                has_alg_on_exec <= 1'b0;
-                                wren_mem3 <= 1'b0;
-                                uc_state <= COPY_READ;
-
-                            end else begin
-                                if ((((new_x < 10'd80 || new_x > 10'd239 ) || (new_y < 10'd60 ||  new_y > 10'd179)) && next_zoom == 3'b011) || (((new_x < 10'd120 || new_x > 10'd199 ) || (new_y < 10'd90 ||  new_y > 10'd149)) && next_zoom == 3'b010) || (((new_x < 10'd140 || new_x > 10'd179 ) || (new_y < 10'd105 ||  new_y > 10'd134)) && next_zoom == 3'b001)) begin
-                                    current_step <= current_step + 1'b1;
-                                    data_to_write <= 8'b0;
-                                    counter_rd_wr <= 2'b0;
-                                    wren_mem3 <= 1'b1;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    op_step <= 3'b000;
-                                    if(new_x >= 10'd319) begin
-                                        new_x <= 10'd0;
-                                        new_y <= new_y + 1'b1;
-                                    end else begin
-                                        new_x <= new_x + 1'b1;
-                                    end
-                                    uc_state <= WAIT_WR_OR_RD;
-                                end else begin
-                                    if (op_step == 3'b000) begin
-                                        addr_for_read <= old_x + (old_y*10'd320);
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b0;
-                                        uc_state <= WAIT_WR_OR_RD;
-                                        if (next_zoom == 3'b011) begin
-                                            old_x <= old_x + 1'b1;
-                                        end else if (next_zoom == 3'b010) begin
-                                            old_x <= old_x + 2'd2;
-                                        end else if (next_zoom == 3'b001) begin
-                                            old_x <= old_x + 3'd4;
-                                        end
-
-                                        op_step <= 3'b001;
-                                    end else if (op_step == 3'b001) begin
-                                        data_to_avg[7:0] <= data_out_mem1;
-                                        addr_for_read <= old_x + (old_y*10'd320);
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b0;
-                                        uc_state <= WAIT_WR_OR_RD;
-                                        if (next_zoom == 3'b011) begin
-                                            old_x <= old_x - 1'b1;
-                                            old_y <= old_y + 1'b1;
-                                        end else if (next_zoom == 3'b010) begin
-                                            old_x <= old_x - 2'd2;
-                                            old_y <= old_y + 2'd2;
-                                        end else if (next_zoom == 3'b001) begin
-                                            old_x <= old_x - 3'd4;
-                                            old_y <= old_y + 3'd4;
-                                        end
-                                        op_step <= 3'b010;
-                                    end else if (op_step == 3'b010) begin
-                                        data_to_avg[15:8] <= data_out_mem1;
-                                        addr_for_read <= old_x + (old_y*10'd320);
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b0;
-                                        uc_state <=WAIT_WR_OR_RD;
-                                        if (next_zoom == 3'b011) begin
-                                            old_x <= old_x + 1'b1;
-                                        end else if (next_zoom == 3'b010) begin
-                                            old_x <= old_x + 2'd2;
-                                        end else if (next_zoom == 3'b001) begin
-                                            old_x <= old_x + 3'd4;
-                                        end
-                                        op_step <= 3'b011;
-                                    end else if (op_step == 3'b011) begin
-                                        data_to_avg[23:16] <= data_out_mem1;
-                                        addr_for_read <= old_x + (old_y*10'd320);
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b0;
-                                        uc_state <= WAIT_WR_OR_RD;
-                                        if (((old_x >= 10'd319) && (next_zoom == 3'b011)) || ((old_x >= 10'd318) && (next_zoom == 3'b010)) || ((old_x >= 10'd316) && (next_zoom == 3'b001))) begin
-                                            old_x <= 10'd0;
-                                            if (next_zoom == 3'b011) begin
-                                                old_y <= old_y + 1'b1;
-                                            end else if (next_zoom == 3'b010) begin
-                                                old_y <= old_y + 2'd2;
-                                            end else if (next_zoom == 3'b001) begin
-                                                old_y <= old_y + 3'd4;
-                                            end
-                                        end else begin
-                                            
-                                            if (next_zoom == 3'b011) begin
-                                                old_y <= old_y - 1'b1;
-                                                old_x <= old_x + 1'b1;
-                                            end else if (next_zoom == 3'b010) begin
-                                                old_y <= old_y - 2'd2;
-                                                old_x <= old_x + 2'd2;
-                                            end else if (next_zoom == 3'b001) begin
-                                                old_y <= old_y - 3'd4;
-                                                old_x <= old_x + 3'd4;
-                                            end
-                                        end
-                                        op_step <= 3'b100;
-                                    end else if (op_step == 3'b100) begin
-                                        data_to_avg[31:24] <= data_out_mem1;
-                                        uc_state <= ALGORITHM;
-                                        op_step <= 3'b101;
-                                    end else if (op_step == 3'b101) begin
-                                        current_step <= current_step + 1'b1;
-                                        data_to_write <= (data_to_avg>> 2'd2);
-                                        addr_for_write <= new_x + (new_y*10'd320);
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b1;
-                                        op_step <= 3'b000;
-                                        if (new_x >= 10'd319) begin
-                                            new_x <= 10'd0;
-                                            new_y <= new_y + 1'b1;
-                                        end else begin
-                                            new_x <= new_x + 1'b1;
-                                        end
-                                        uc_state <= WAIT_WR_OR_RD;
-                                    end
-                                end
-                            end
-                        end
+                end else if (cache_hit) begin
+                    // o quadro já está num buffer: só troca a frente
+                    if (hit_buf != front_buf) begin
+                        back_buf <= hit_buf;
+                        flip_now <= 1'b1;
                     end
-                    NH_ALG: begin
-                        if (!has_alg_on_exec) begin
-                            has_alg_on_exec <= 1'b1;
-                            current_step <= 19'd0;
-                            needed_steps <= 19'd76799;
-                            op_step <= 3'b0;
-                            new_x <= 10'b0;
-                            new_y <= 10'b0;
-                            old_x <= 10'd0;
-                            old_y <= 10'd0;
-                            
-                        end else begin
-                            if (current_step >= needed_steps) begin
-                                counter_address <= 17'd0;
-                                counter_rd_wr <= 2'b0;
-                                has_alg_on_exec <= 1'b0;
-                                wren_mem3 <= 1'b0;
-                                
-                                uc_state <= COPY_READ;
-
-                            end else begin
-                                if ((((new_x < 10'd80 || new_x > 10'd239 ) || (new_y < 10'd60 ||  new_y > 10'd179)) && next_zoom == 3'b011) || (((new_x < 10'd120 || new_x > 10'd199 ) || (new_y < 10'd90 ||  new_y > 10'd149)) && next_zoom == 3'b010) || (((new_x < 10'd140 || new_x > 10'd179 ) || (new_y < 10'd105 ||  new_y > 10'd134)) && next_zoom == 3'b001)) begin
-                                    current_step <= current_step + 1'b1;
-                                    data_to_write <= 8'b0;
-                                    counter_rd_wr <= 2'b0;
-                                    wren_mem3 <= 1'b1;
-                                    addr_for_write <= new_x + (new_y*10'd320);
-                                    op_step <= 3'b000;
-                                    if(new_x >= 10'd319) begin
-                                        new_x <= 10'd0;
-                                        new_y <= new_y + 1'b1;
-                                    end else begin
-                                        new_x <= new_x + 1'b1;
-                                    end
-                                    uc_state <= WAIT_WR_OR_RD;
-                                end else begin
-                                    if (op_step == 3'b000) begin
-                                        if (next_zoom == 3'b011) begin
-                                            addr_for_read <= (old_x<<1) + ((old_y<<1)*10'd320);
-                                        end else if (next_zoom == 3'b010) begin
-                                            addr_for_read <= (old_x<<2) + ((old_y<<2)*10'd320);
-                                        end else if (next_zoom == 3'b001) begin
-                                            addr_for_read <= (old_x<<3) + ((old_y<<3)*10'd320);
-                                        end
-                                        
-                                        counter_rd_wr <= 2'b0;
-                                        wren_mem3 <= 1'b0;
-                                        uc_state <= WAIT_WR_OR_RD;
-                                        if (next_zoom == 3'b011) begin
-                                            if (old_x >= 10'd159) begin
-                                                old_x <= 10'd0;
-                                                old_y <= old_y + 2'd1;
-                                            end else begin
-                                                old_x <= old_x + 2'd1;
-                                            end
-                                        end else if (next_zoom == 3'b010) begin
-                                            if (old_x >= 10'd79) begin
-                                                old_x <= 10'd0;
-                                                old_y <= old_y + 2'd1;
-                                            end else begin
-                                                old_x <= old_x + 2'd1;
-                                            end
-                                        end else if (next_zoom == 3'b001) begin
-                                            if (old_x >= 10'd39) begin
-                                                old_x <= 10'd0;
-                                                old_y <= old_y + 2'd1;
-                                            end else begin
-                                                old_x <= old_x + 2'd1;
-                                            end
-                                        end else begin
-                                            old_x <= new_x;
-                                            old_y <= new_y;
-                                        end
-                                        op_step <= 3'b001;
-                                    end else if (op_step == 3'b001) begin
-                                        current_step <= current_step + 1'b1;
-                                        data_to_write <= data_out_mem1;
-                                        counter_rd_wr <= 2'b0;
-                                        addr_for_write <= new_x + (new_y*10'd320);
-                                        wren_mem3 <= 1'b1;
-                                        op_step <= 3'b000;
-                                        uc_state <= WAIT_WR_OR_RD;
-                                        if (new_x >= 10'd319) begin
-                                            new_x <= 10'd0;
-                                            new_y <= new_y + 1'b1;
-                                        end else begin
-                                            new_x <= new_x + 1'b1;
-                                        end
-                                    end
-                                end
-                            end
-                        end
+                    cache_hit_p  <= 1'b1;
+                    current_zoom <= next_zoom;
+                    scan_on      <= 1'b0;
+                    front_base   <= (cache_key == KEY_1X);
+                    disp_zoom    <= next_zoom;
+                    pan_x        <= view_x;
+                    pan_y        <= view_y;
+                    uc_state     <= IDLE;
+                end else if (last_instruction == RESET_INST) begin
+                    // volta ao 1x: cópia da mem1
+                    cache_miss_p    <= cache_on;
+                    counter_address <= 15'd0;
+                    copy_valid      <= 2'b00;
+                    copy_issued     <= 1'b0;
+                    uc_state        <= COPY_READ;
+                end else begin
+                    // os algoritmos rodam nos motores de fluxo, direto no buffer de trás
+                    cache_miss_p <= cache_on;
+                    if (cache_on) begin
+                        back_buf <= victim;
                     end
-                endcase
+                    tag_valid[cache_on ? victim : back_buf] <= 1'b0;
+                    fill_dirty <= 1'b0;
+                    zoom_start <= 1'b1;
+                    uc_state   <= STREAM;
+                end
             end
 
             RESET: begin
                 FLAG_DONE <= 1'b0;
                 next_zoom <= 3'b100;
+                scan_on <= 1'b0;
+                center_x <= 9'd160;
+                center_y <= 8'd120;
+                tag_valid <= 4'b0000;
                 FLAG_ERROR <= 1'b0;
                 last_instruction <= RESET_INST;
+                flip_on_vsync <= 1'b0;
+                copy_valid <= 2'b00;
+                copy_issued <= 1'b0;
                 
-                counter_address <= 17'd0;
+                counter_address <= 15'd0;
                 counter_rd_wr <= 2'b0;
                 uc_state       <= COPY_READ;
 
             end
 
             COPY_READ: begin
-                if(counter_rd_wr == 2'b10) begin
-                    wren_mem2 <= 1'b0; // Garante que não estamos escrevendo nada ainda
-                    counter_rd_wr <= 2'b00;
-                    uc_state <= COPY_WRITE;
-                    
+                FLAG_DONE <= 1'b0;
+                if (swap_pending) begin
+                    // o buffer de trás ainda espera o vsync de um REFRESH_SCREEN + EXT_VSYNC
                 end else begin
-                    counter_rd_wr <= counter_rd_wr + 1;
+                    // mem1 -> buffer de trás, uma palavra (4 pixels) por ciclo: lê
+                    // counter_address e escreve a palavra lida 2 ciclos antes
+                    copy_addr_p1   <= counter_address;
+                    copy_addr_p2   <= copy_addr_p1;
+                    copy_valid     <= {copy_valid[0], !copy_issued};
+                    addr_for_write <= copy_addr_p2;
+                    data_to_write  <= data_out_mem1;
+                    wren_back      <= copy_valid[1];
+                    if (counter_address == 15'd0 && !copy_issued) begin
+                        base_dirty <= 1'b0; // escritas na mem1 daqui em diante voltam a marcá-la
+                        fill_dirty <= 1'b0;
+                        // as escritas começam 2 ciclos depois: dá tempo de trocar o buffer de trás
+                        if (cache_on) begin
+                            back_buf <= victim;
+                        end
+                        tag_valid[cache_on ? victim : back_buf] <= 1'b0;
+                    end
+                    if (counter_address == 15'd19199) begin
+                        copy_issued <= 1'b1;
+                    end else begin
+                        counter_address <= counter_address + 1'b1;
+                    end
+                    if (copy_valid[1] && copy_addr_p2 == 15'd19199) begin
+                        // a última escrita sai nesta borda: troca no vsync ou no próximo ciclo
+                        if (flip_on_vsync) begin
+                            swap_pending <= 1'b1;
+                        end else begin
+                            flip_now <= 1'b1;
+                        end
+                        current_zoom <= next_zoom;
+                        front_base   <= 1'b1;
+                        tag_key[back_buf]   <= KEY_1X;
+                        tag_valid[back_buf] <= cache_on && !fill_dirty;
+                        if (last_ext == EXT_SCAN) begin
+                            scan_on <= 1'b1;
+                        end
+                        disp_zoom    <= next_zoom;
+                        pan_x        <= view_x;
+                        pan_y        <= view_y;
+                        uc_state     <= IDLE;
+                    end
                 end
             end
 
-            COPY_WRITE: begin
-
-                if (last_instruction == RESET_INST || last_instruction == STORE) begin
-                    data_in_mem2 <= data_out_mem1;
-                end else begin
-                    data_in_mem2 <= data_out_mem3;
+            STREAM: begin
+                zoom_start <= 1'b0;
+                FLAG_DONE  <= 1'b0;
+                if (zoom_done || zout_done || zsc_done || zbl_done) begin
+                    // a última escrita sai neste ciclo: troca no próximo
+                    tag_key[back_buf]   <= cache_key;
+                    tag_valid[back_buf] <= cache_on && !fill_dirty;
+                    current_zoom <= next_zoom;
+                    flip_now     <= 1'b1;
+                    scan_on      <= 1'b0;  // o resultado já está na escala final
+                    front_base   <= 1'b0;
+                    uc_state     <= IDLE;
                 end
-                addr_wr_mem2 <= counter_address; // Define o endereço de escrita na MEM2
-                wren_mem2    <= 1'b1;             // Habilita a escrita na MEM2
-                
-                if (counter_rd_wr == 2'b10) begin
-                    counter_rd_wr <= 2'b00;
-                    if (counter_address == 17'd76799) begin // 320*240 - 1
-                        current_zoom <= next_zoom;
-                        FLAG_DONE <= 1'b1;
-                        uc_state <= IDLE; // Cópia concluída
-                        
-                    end else begin
-                        counter_address <= counter_address + 1'b1; // Incrementa para o próximo pixel
-                        uc_state <= COPY_READ; // Volta para o estado de leitura
-                    end
-                end else begin
-                    counter_rd_wr <= counter_rd_wr + 1;
+            end
+
+            DMA_WAIT: begin
+                dma_start <= 1'b0;
+                FLAG_DONE <= 1'b0;
+                if (dma_done) begin
+                    FLAG_DONE <= 1'b1;
+                    uc_state <= IDLE;
                 end
             end
 
@@ -780,18 +909,18 @@ module main(
                     if (last_instruction == LOAD) begin
                         uc_state <= IDLE;
                         if (SEL_MEM) begin
-                            DATA_OUT <= data_out_mem3;
+                            DATA_OUT <= data_out_back >> {MEM_ADDR[1:0], 3'b000};
                         end else begin
-                            DATA_OUT <= data_out_mem1;
+                            DATA_OUT <= data_out_mem1 >> {MEM_ADDR[1:0], 3'b000};
                         end
                         FLAG_DONE <= 1'b1;
                     end else if (last_instruction == STORE) begin
                         uc_state <= IDLE;
                         wren_mem1 <= 1'b0;
                         counter_rd_wr <= 2'b0;
-                        counter_address <= 17'd0;
+                        counter_address <= 15'd0;
                     end else begin
-                        wren_mem3 <= 1'b0;
+                        wren_back <= 1'b0;
                         uc_state <= ALGORITHM;
                     end
                 end else begin
@@ -801,21 +930,22 @@ module main(
             
             default: uc_state <= IDLE;
         endcase
+
+        // qualquer escrita na mem1 invalida a cópia em 1x que está na frente
+        // e todos os níveis do cache
+        if (wren_mem1 || vram_wr || dma_wren) begin
+            base_dirty <= 1'b1;
+            fill_dirty <= 1'b1;
+            tag_valid  <= 4'b0000;
+        end
     
     end
 
-    reg [16:0] addr_for_copy;
-
     always @(*) begin
-          // Endereçamento
-
-        if (last_instruction == RESET_INST || last_instruction == STORE) begin
-            addr_for_copy <= counter_address;
-        end else begin
-            addr_mem3 <= counter_address;
-        end
-        
-        addr_mem2 <= addr_from_vga;
+          // Endereçamento: o buffer de trás é lido pelo LOAD (SEL_MEM) ou pela
+          // janela VRAM; o da frente pelo VGA ou pela janela, fora da área visível
+        addr_back  = vram_rd_back ? VRAM_ADDRESS[16:2] : counter_address;
+        addr_front = vram_rd_front ? VRAM_ADDRESS[16:2] : addr_from_vga[16:2];
     end
 
     wire [16:0] addr_from_memory_control_wr;
@@ -825,6 +955,102 @@ module main(
     // 6. Instâncias de Módulos
     //================================================================
 
+    dma_reader dma0(
+        .clock(clk_100),
+        .reset(1'b0),
+        .start(dma_start),
+        .spans(dma_spans),
+        .rle(dma_rle),
+        .src_addr(DATA_PACKED),
+        .length(MEM_ADDR),
+        .busy(dma_busy),
+        .done(dma_done),
+        .avm_address(DMA_ADDRESS),
+        .avm_read(DMA_READ),
+        .avm_burstcount(DMA_BURSTCOUNT),
+        .avm_readdata(DMA_READDATA),
+        .avm_readdatavalid(DMA_READDATAVALID),
+        .avm_waitrequest(DMA_WAITREQUEST),
+        .mem_addr(dma_mem_addr),
+        .mem_data(dma_mem_data),
+        .mem_be(dma_mem_be),
+        .mem_wren(dma_wren)
+    );
+
+    zoom_stream zoom0(
+        .clock(clk_100),
+        .start(zoom_start && !zoom_out_alg && !scale_alg && !bilinear_alg),
+        .zoom(next_zoom),
+        .org_x(view_x),
+        .org_y(view_y),
+        .busy(zoom_busy),
+        .done(zoom_done),
+        .rd_addr(zoom_rd_addr),
+        .rd_data(data_out_mem1),
+        .wr_addr(zoom_wr_addr),
+        .wr_data(zoom_wr_data),
+        .wr_en(zoom_wr_en)
+    );
+
+    zoom_out_stream zout0(
+        .clock(clk_100),
+        .start(zoom_start && zoom_out_alg),
+        .average(last_instruction == BA_ALG),
+        .zoom(next_zoom),
+        .win_w(view_x[8:2]),
+        .win_y(view_y),
+        .busy(zout_busy),
+        .done(zout_done),
+        .rd_addr(zout_rd_addr),
+        .rd_data(data_out_mem1),
+        .wr_addr(zout_wr_addr),
+        .wr_data(zout_wr_data),
+        .wr_en(zout_wr_en)
+    );
+
+    zoom_scale_stream zsc0(
+        .clock(clk_100),
+        .start(zoom_start && scale_alg),
+        .scale(scale_q8),
+        .center_x(center_x),
+        .center_y(center_y),
+        .busy(zsc_busy),
+        .done(zsc_done),
+        .rd_addr(zsc_rd_addr),
+        .rd_data(data_out_mem1),
+        .wr_addr(zsc_wr_addr),
+        .wr_data(zsc_wr_data),
+        .wr_en(zsc_wr_en)
+    );
+
+    zoom_bilinear_stream zbl0(
+        .clock(clk_100),
+        .start(zoom_start && bilinear_alg),
+        .zoom(next_zoom),
+        .org_x(view_x),
+        .org_y(view_y),
+        .busy(zbl_busy),
+        .done(zbl_done),
+        .rd_addr(zbl_rd_addr),
+        .rd_data(data_out_mem1),
+        .wr_addr(zbl_wr_addr),
+        .wr_data(zbl_wr_data),
+        .wr_en(zbl_wr_en)
+    );
+
+    perf_counters perf0(
+        .clock(clk_100),
+        .state(uc_state),
+        .op_start(enable_pulse && uc_state == IDLE),
+        .idle(uc_state == IDLE),
+        .vsync(vsync_pulse),
+        .flip((vsync_pulse && swap_pending) || flip_now),
+        .cache_hit(cache_hit_p),
+        .cache_miss(cache_miss_p),
+        .sel(PERF_SEL),
+        .value(PERF_DATA)
+    );
+
     vga_module vga_out(.clock(clk_25_vga), 
     .reset(1'b0), 
     .color_in(data_to_vga_pipe), 
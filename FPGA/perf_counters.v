@@ -0,0 +1,144 @@
+module perf_counters(
+    input             clock,
+
+    // Observação da FSM do main
+    input      [2:0]  state,        // uc_state
+    input             op_start,     // pulso: comando aceito no IDLE
+    input             idle,         // FSM no IDLE
+    input             vsync,        // pulso: início do vsync do VGA
+    input             flip,         // pulso: troca do buffer de exibição
+    input             cache_hit,    // pulso: nível achado no cache (só troca a frente)
+    input             cache_miss,   // pulso: nível calculado com o cache ligado
+
+    // Leitura pelo HPS (PIOs PERF_SEL/PERF)
+    input      [5:0]  sel,          // registrador escolhido (ver mapa abaixo)
+    output reg [31:0] value
+);
+
+    //================================================================
+    // Mapa de registradores (palavras de 32 bits, selecionadas por sel)
+    //
+    //  0       identificação ("PERF"); enquanto sel == 0 a cópia
+    //          (snapshot) acompanha os contadores. Ao trocar o sel ela
+    //          congela, então as duas metades de cada contador de 64 bits
+    //          e os demais registradores são lidos coerentes entre si.
+    //  1, 2    timestamp (ciclos de clk_100 desde a configuração), lo/hi
+    //  3..18   ciclos em cada estado: 3 + 2*estado (lo), 4 + 2*estado (hi)
+    //  19      comandos concluídos
+    //  20      ciclos do último comando (do ENABLE até voltar ao IDLE)
+    //  21      quadros varridos pelo VGA (pulsos de vsync)
+    //  22      trocas do buffer de exibição (quadros novos na tela)
+    //  23, 24  acertos e falhas do cache de níveis
+    //================================================================
+    localparam ID = 32'h50455246; // "PERF"
+
+    reg [63:0] timestamp;
+    reg [63:0] state_cycles [0:7];
+    reg [31:0] ops_done;
+    reg [31:0] op_cycles, last_op_cycles;
+    reg        op_active;
+    reg [31:0] vsyncs, flips;
+    reg [31:0] cache_hits, cache_misses;
+
+    reg [63:0] snap_timestamp;
+    reg [63:0] snap_state_cycles [0:7];
+    reg [31:0] snap_ops_done, snap_last_op_cycles;
+    reg [31:0] snap_vsyncs, snap_flips;
+    reg [31:0] snap_cache_hits, snap_cache_misses;
+
+    integer i;
+
+    initial begin
+        timestamp      = 64'd0;
+        ops_done       = 32'd0;
+        op_cycles      = 32'd0;
+        last_op_cycles = 32'd0;
+        op_active      = 1'b0;
+        vsyncs         = 32'd0;
+        flips          = 32'd0;
+        cache_hits     = 32'd0;
+        cache_misses   = 32'd0;
+        for (i = 0; i < 8; i = i + 1) begin
+            state_cycles[i] = 64'd0;
+        end
+    end
+
+    //================================================================
+    // Contadores (sempre ativos; o RESET do main não os zera)
+    //================================================================
+    always @(posedge clock) begin
+        timestamp           <= timestamp + 1'b1;
+        state_cycles[state] <= state_cycles[state] + 1'b1;
+        vsyncs              <= vsyncs + vsync;
+        flips               <= flips + flip;
+        cache_hits          <= cache_hits + cache_hit;
+        cache_misses        <= cache_misses + cache_miss;
+
+        if (op_active && idle) begin
+            ops_done       <= ops_done + 1'b1;
+            last_op_cycles <= op_cycles;
+        end
+
+        if (op_start) begin
+            // comandos que não saem do IDLE (ex: zoom no limite) também contam
+            op_active <= 1'b1;
+            op_cycles <= 32'd1;
+        end else if (op_active && idle) begin
+            op_active <= 1'b0;
+        end else if (op_active) begin
+            op_cycles <= op_cycles + 1'b1;
+        end
+    end
+
+    //================================================================
+    // Sincronização do sel (vem do domínio da ponte LW) e snapshot
+    //================================================================
+    reg [5:0] sel_meta, sel_sync;
+    always @(posedge clock) begin
+        sel_meta <= sel;
+        sel_sync <= sel_meta;
+    end
+
+    always @(posedge clock) begin
+        if (sel_sync == 6'd0) begin
+            snap_timestamp      <= timestamp;
+            snap_ops_done       <= ops_done;
+            snap_last_op_cycles <= last_op_cycles;
+            snap_vsyncs         <= vsyncs;
+            snap_flips          <= flips;
+            snap_cache_hits     <= cache_hits;
+            snap_cache_misses   <= cache_misses;
+            for (i = 0; i < 8; i = i + 1) begin
+                snap_state_cycles[i] <= state_cycles[i];
+            end
+        end
+    end
+
+    always @(posedge clock) begin
+        if (sel_sync == 6'd0) begin
+            value <= ID;
+        end else if (sel_sync == 6'd1) begin
+            value <= snap_timestamp[31:0];
+        end else if (sel_sync == 6'd2) begin
+            value <= snap_timestamp[63:32];
+        end else if (sel_sync <= 6'd18) begin
+            value <= sel_sync[0] ? snap_state_cycles[(sel_sync - 6'd3) >> 1][31:0]
+                                 : snap_state_cycles[(sel_sync - 6'd3) >> 1][63:32];
+        end else if (sel_sync == 6'd19) begin
+            value <= snap_ops_done;
+        end else if (sel_sync == 6'd20) begin
+            value <= snap_last_op_cycles;
+        end else if (sel_sync == 6'd21) begin
+            value <= snap_vsyncs;
+        end else if (sel_sync == 6'd22) begin
+            value <= snap_flips;
+        end else if (sel_sync == 6'd23) begin
+            value <= snap_cache_hits;
+        end else if (sel_sync == 6'd24) begin
+            value <= snap_cache_misses;
+        end else begin
+            value <= 32'd0;
+        end
+    end
+
+endmodule
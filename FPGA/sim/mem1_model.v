@@ -0,0 +1,43 @@
+// Modelo comportamental da mem1 (altsyncram DUAL_PORT de mem1.v) para a
+// co-simulação com Verilator. Mesma interface e mesma latência de leitura:
+// endereço registrado + saída registrada (2 ciclos). 19200 palavras de
+// 32 bits (4 pixels, o de menor endereço no byte 0), escrita com byteena_a;
+// escrita fora da faixa é ignorada e leitura fora da faixa devolve 0.
+// O conteúdo inicial é zero.
+module mem1 (
+    input             clock,
+    input      [3:0]  byteena_a,
+    input      [31:0] data,
+    input      [14:0] rdaddress,
+    input      [14:0] wraddress,
+    input             wren,
+    output     [31:0] q
+);
+
+    localparam WORDS = 19200;
+
+    reg [31:0] ram [0:WORDS-1];
+    reg [14:0] rdaddress_reg;
+    reg [31:0] q_reg;
+
+    integer i;
+    initial begin
+        for (i = 0; i < WORDS; i = i + 1) ram[i] = 32'd0;
+        rdaddress_reg = 15'd0;
+        q_reg = 32'd0;
+    end
+
+    always @(posedge clock) begin
+        if (wren && wraddress < WORDS) begin
+            if (byteena_a[0]) ram[wraddress][7:0]   <= data[7:0];
+            if (byteena_a[1]) ram[wraddress][15:8]  <= data[15:8];
+            if (byteena_a[2]) ram[wraddress][23:16] <= data[23:16];
+            if (byteena_a[3]) ram[wraddress][31:24] <= data[31:24];
+        end
+        rdaddress_reg <= rdaddress;
+        q_reg <= (rdaddress_reg < WORDS) ? ram[rdaddress_reg] : 32'd0;
+    end
+
+    assign q = q_reg;
+
+endmodule
@@ -0,0 +1,27 @@
+// Modelo comportamental do pll (aux_files/pll.v) para a co-simulação com
+// Verilator. O testbench alterna o refclk na frequência do clk_100, então
+// outclk_0 é o próprio refclk e outclk_1 (clk_25 do VGA) é refclk / 4.
+module pll (
+    input  wire refclk,
+    input  wire rst,
+    output wire outclk_0,
+    output wire outclk_1,
+    output wire outclk_2,
+    output wire outclk_3,
+    output wire locked
+);
+
+    reg [1:0] div = 2'd0;
+
+    always @(posedge refclk) begin
+        if (rst) div <= 2'd0;
+        else     div <= div + 1'b1;
+    end
+
+    assign outclk_0 = refclk;
+    assign outclk_1 = div[1];
+    assign outclk_2 = 1'b0;
+    assign outclk_3 = 1'b0;
+    assign locked   = 1'b1;
+
+endmodule
@@ -0,0 +1,333 @@
+/*
+ * =========================================================================
+ * tb_dma_reader.cpp: Bancada do dma_reader.v contra um modelo da DDR
+ * =========================================================================
+ *
+ * Dirige o dma_reader sozinho (Verilator, --top-module dma_reader). Do
+ * lado Avalon, um escravo de rajadas faz o papel da ponte FPGA-HPS:
+ * waitrequest aleatório, latência variável até a primeira palavra,
+ * buracos no readdatavalid e várias rajadas pendentes. Do lado da mem1,
+ * as escritas (com byteena) vão para um vetor que é comparado, no fim de
+ * cada transferência, com a imagem que a decodificação em C produz.
+ *
+ * Casos:
+ * - simples: quadro inteiro, tamanhos que não são múltiplos de 4, 1 byte
+ *   e 0 bytes (done sem nenhuma leitura);
+ * - trechos: listas aleatórias com trechos de 0 a 300 pixels, em qualquer
+ *   alinhamento, incluindo o primeiro e o último pixel da imagem;
+ * - RLE: literais e repetições nos limites (1/128 e 2/129) e quadros
+ *   aleatórios, com o tamanho comprimido fora do múltiplo de 4.
+ *
+ * Em todos: um único pulso de done, nenhuma leitura fora da origem, no
+ * máximo 32 palavras (a FIFO) entre pedidas e escritas, nenhuma escrita
+ * fora da mem1. Para cada perfil da ponte imprime os ciclos de cada modo.
+ *
+ * Uso: make sim_dma (ver HPS/makefile). Sai com 1 se algo divergir.
+ *
+ */
+
+#include "Vdma_reader.h"
+#include "Vdma_reader___024root.h"
+#include "verilated.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+static const unsigned IMAGE_SIZE = 76800;
+static const uint32_t DDR_BASE = 0x30000000u; // onde a origem é posta na "DDR"
+static const uint64_t XFER_TIMEOUT = 2000000;
+
+static VerilatedContext *ctx;
+static Vdma_reader *top;
+static uint64_t cycles;
+static int failures;
+
+// xorshift32: a mesma sequência em qualquer máquina
+static uint32_t rng_state = 4004;
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ===================================================================
+ * Modelo da DDR (escravo Avalon-MM de rajadas)
+ * =================================================================== */
+
+struct Burst {
+    uint32_t addr;
+    unsigned left;
+    uint64_t ready; // ciclo da primeira palavra
+};
+
+static std::vector<uint8_t> ddr;  // a origem, a partir de DDR_BASE
+static std::deque<Burst> pending; // aceitas, ainda com palavras a devolver
+static unsigned wait_pct, gap_pct, lat_min, lat_max;
+static uint32_t words_read;       // palavras devolvidas na transferência
+static unsigned max_in_flight;
+
+static uint8_t mem1[IMAGE_SIZE];
+
+// Um ciclo do clock; o escravo decide antes da borda o que apresenta
+static void tick(void) {
+    // waitrequest e dados desta borda
+    top->avm_waitrequest = (rng() % 100) < wait_pct;
+    top->avm_readdatavalid = 0;
+    if (!pending.empty() && pending.front().ready <= cycles && (rng() % 100) >= gap_pct) {
+        Burst &b = pending.front();
+        uint32_t word = 0;
+        if (b.addr < DDR_BASE || b.addr - DDR_BASE + 4 > ddr.size()) {
+            fprintf(stderr, "FALHA: leitura fora da origem em 0x%08x\n", b.addr);
+            failures++;
+        } else {
+            memcpy(&word, &ddr[b.addr - DDR_BASE], 4);
+        }
+        top->avm_readdata = word;
+        top->avm_readdatavalid = 1;
+        words_read++;
+        b.addr += 4;
+        if (--b.left == 0) {
+            pending.pop_front();
+        }
+    }
+
+    top->clock = 0;
+    top->eval();
+    if (top->avm_read && !top->avm_waitrequest) {
+        unsigned n = top->avm_burstcount;
+        if (n == 0 || n > 8 || (top->avm_address & 3)) {
+            fprintf(stderr, "FALHA: rajada inválida (0x%08x, %u palavras)\n", top->avm_address, n);
+            failures++;
+        }
+        uint64_t ready = cycles + lat_min + (lat_max > lat_min ? rng() % (lat_max - lat_min + 1) : 0);
+        if (!pending.empty() && ready < pending.back().ready) {
+            ready = pending.back().ready; // a ponte devolve na ordem
+        }
+        pending.push_back(Burst{top->avm_address, n, ready});
+    }
+    if (top->mem_wren) {
+        if (top->mem_addr >= IMAGE_SIZE / 4) {
+            fprintf(stderr, "FALHA: escrita fora da mem1 (palavra %u)\n", top->mem_addr);
+            failures++;
+        } else {
+            for (int i = 0; i < 4; i++) {
+                if (top->mem_be >> i & 1) {
+                    mem1[top->mem_addr * 4 + i] = (uint8_t)(top->mem_data >> (8 * i));
+                }
+            }
+        }
+    }
+
+    top->clock = 1;
+    top->eval();
+    cycles++;
+    ctx->timeInc(1);
+}
+
+/* ===================================================================
+ * Uma transferência
+ * =================================================================== */
+
+// Roda uma transferência da origem (já em ddr) e confere a mem1 com want;
+// devolve os ciclos do start ao done
+static uint64_t transfer(const char *what, int spans, int rle, const uint8_t *want) {
+    uint32_t length = ddr.size();
+    ddr.resize((length + 3) & ~3u, 0xEE); // a última palavra é lida inteira
+    words_read = 0;
+    max_in_flight = 0;
+
+    top->src_addr = DDR_BASE;
+    top->length = length;
+    top->spans = spans;
+    top->rle = rle;
+    top->start = 1;
+    tick();
+    top->start = 0;
+
+    uint64_t start = cycles;
+    unsigned dones = 0;
+    while (cycles - start < XFER_TIMEOUT) {
+        if (top->done) {
+            dones++;
+        }
+        if (!top->busy && (dones || length == 0)) {
+            break;
+        }
+        tick();
+        unsigned in_flight = (uint16_t)(top->rootp->dma_reader__DOT__words_requested -
+                                        top->rootp->dma_reader__DOT__words_consumed);
+        max_in_flight = in_flight > max_in_flight ? in_flight : max_in_flight;
+    }
+    uint64_t n = cycles - start;
+    // mais alguns ciclos: nenhum done extra, nenhuma palavra sobrando
+    for (int i = 0; i < 40; i++) {
+        tick();
+        dones += top->done;
+    }
+
+    if (dones != 1) {
+        fprintf(stderr, "FALHA: %s: %u pulsos de done\n", what, dones);
+        failures++;
+    }
+    if (words_read != (length + 3) / 4 || !pending.empty()) {
+        fprintf(stderr, "FALHA: %s: %u palavras lidas, esperado %u\n", what, words_read, (length + 3) / 4);
+        failures++;
+    }
+    if (max_in_flight > 32) {
+        fprintf(stderr, "FALHA: %s: %u palavras em voo (FIFO de 32)\n", what, max_in_flight);
+        failures++;
+    }
+    for (unsigned i = 0; i < IMAGE_SIZE; i++) {
+        if (mem1[i] != want[i]) {
+            fprintf(stderr, "FALHA: %s: pixel %u = %u, esperado %u\n", what, i, mem1[i], want[i]);
+            failures++;
+            break;
+        }
+    }
+    return n;
+}
+
+/* ===================================================================
+ * Origens: simples, trechos e RLE
+ * =================================================================== */
+
+static void random_frame(uint8_t *img) {
+    // gradiente com ruído e faixas constantes (dão repetições ao RLE)
+    for (unsigned i = 0; i < IMAGE_SIZE; i++) {
+        unsigned x = i % 320, y = i / 320;
+        img[i] = (y / 16) % 3 == 0 ? (uint8_t)(x / 40 * 30) : (uint8_t)(x + y + (rng() & 7));
+    }
+}
+
+// Lista de trechos sobre a mem1 atual; aplica em want
+static void build_spans(std::vector<uint8_t> &list, uint8_t *want, unsigned count) {
+    list.clear();
+    for (unsigned s = 0; s < count; s++) {
+        unsigned len = rng() % 301, addr;
+        switch (s % 8) {
+            case 0: addr = 0; break;                                   // primeiro pixel
+            case 1: addr = IMAGE_SIZE - (len ? len : 1); break;        // até o último
+            default: addr = rng() % (IMAGE_SIZE - len); break;
+        }
+        uint32_t head = (len << 17) | addr;
+        for (int i = 0; i < 4; i++) {
+            list.push_back((uint8_t)(head >> (8 * i)));
+        }
+        for (unsigned k = 0; k < len; k++) {
+            uint8_t p = (uint8_t)rng();
+            list.push_back(p);
+            want[addr + k] = p;
+        }
+        while (list.size() & 3) {
+            list.push_back(0xEE);
+        }
+    }
+}
+
+// Um bloco RLE: literal (c < 128) ou repetição (c >= 128)
+static void rle_block(std::vector<uint8_t> &out, std::vector<uint8_t> &pixels, unsigned n, int repeat) {
+    if (repeat) {
+        uint8_t v = (uint8_t)rng();
+        out.push_back((uint8_t)(n + 126));
+        out.push_back(v);
+        pixels.insert(pixels.end(), n, v);
+    } else {
+        out.push_back((uint8_t)(n - 1));
+        for (unsigned k = 0; k < n; k++) {
+            uint8_t v = (uint8_t)rng();
+            out.push_back(v);
+            pixels.push_back(v);
+        }
+    }
+}
+
+// Quadro RLE com os limites dos blocos e, depois, blocos aleatórios até
+// completar a imagem
+static void build_rle(std::vector<uint8_t> &out, uint8_t *want) {
+    std::vector<uint8_t> pixels;
+    out.clear();
+    rle_block(out, pixels, 1, 0);
+    rle_block(out, pixels, 128, 0);
+    rle_block(out, pixels, 2, 1);
+    rle_block(out, pixels, 129, 1);
+    while (pixels.size() < IMAGE_SIZE) {
+        unsigned left = IMAGE_SIZE - pixels.size();
+        int repeat = rng() & 1 && left >= 2;
+        unsigned n = repeat ? 2 + rng() % 128 : 1 + rng() % 128;
+        rle_block(out, pixels, n < left ? n : left, repeat);
+    }
+    memcpy(want, pixels.data(), IMAGE_SIZE);
+}
+
+int main(void) {
+    ctx = new VerilatedContext;
+    top = new Vdma_reader{ctx};
+    top->reset = 1;
+    top->start = 0;
+    top->avm_readdatavalid = 0;
+    top->avm_waitrequest = 0;
+    for (int i = 0; i < 4; i++) {
+        tick();
+    }
+    top->reset = 0;
+
+    static uint8_t want[IMAGE_SIZE];
+    // perfis da ponte: {waitrequest %, buracos %, latência mín, máx}
+    static const unsigned profiles[][4] = {{0, 0, 1, 1}, {30, 10, 4, 20}, {70, 40, 10, 60}};
+    for (const auto &p : profiles) {
+        uint64_t worst[3] = {0, 0, 0};
+        wait_pct = p[0];
+        gap_pct = p[1];
+        lat_min = p[2];
+        lat_max = p[3];
+        uint64_t n;
+
+        // simples: quadro inteiro e tamanhos que não fecham a palavra
+        static const unsigned lengths[] = {IMAGE_SIZE, IMAGE_SIZE - 1, 4099, 6, 1, 0};
+        for (unsigned len : lengths) {
+            random_frame(want);
+            ddr.assign(want, want + len);
+            memcpy(want + len, mem1 + len, IMAGE_SIZE - len); // o resto da mem1 não muda
+            char what[40];
+            snprintf(what, sizeof(what), "simples, %u bytes", len);
+            n = transfer(what, 0, 0, want);
+            worst[0] = (len == IMAGE_SIZE && n > worst[0]) ? n : worst[0];
+        }
+
+        // trechos sobre a mem1 atual
+        for (int round = 0; round < 4; round++) {
+            memcpy(want, mem1, IMAGE_SIZE);
+            build_spans(ddr, want, 8 + rng() % 200);
+            n = transfer("trechos", 1, 0, want);
+            worst[1] = n > worst[1] ? n : worst[1];
+        }
+
+        // RLE: quadro inteiro, com o tamanho comprimido fora do múltiplo de 4
+        for (int round = 0; round < 2; round++) {
+            do {
+                build_rle(ddr, want);
+            } while (ddr.size() % 4 == 0);
+            n = transfer("RLE", 0, 1, want);
+            worst[2] = n > worst[2] ? n : worst[2];
+        }
+
+        printf("ponte com waitrequest %u%%, buracos %u%%, latência %u-%u: quadro simples %llu, "
+               "trechos (maior lista) %llu, quadro RLE %llu ciclos\n", wait_pct, gap_pct, lat_min, lat_max,
+               (unsigned long long)worst[0], (unsigned long long)worst[1], (unsigned long long)worst[2]);
+    }
+
+    top->final();
+    delete top;
+    delete ctx;
+    if (failures) {
+        fprintf(stderr, "%d falha(s)\n", failures);
+        return 1;
+    }
+    printf("dma_reader: OK\n");
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * =========================================================================
+ * tb_store_packed.cpp: Bancada do STORE empacotado (EXT_PACKED) no main.v
+ * =========================================================================
+ *
+ * Dirige as portas do main (Verilator, com mem1_model.v e pll_model.v)
+ * sem passar pela api.h e confere a mem1 contra um modelo em C:
+ *
+ * - os 4 alinhamentos (MEM_ADDR % 4 = 0..3), cada um no início, no meio
+ *   e no fim da imagem, com os vizinhos de cada lado preenchidos para
+ *   pegar byteenable errado (pixel fora da faixa ou palavra vizinha);
+ * - 76796 é o último endereço válido; 76797 e acima levantam FLAG_ERROR
+ *   e não escrevem nada (o RESET limpa o erro);
+ * - rajada aleatória de STOREs empacotados e simples, um atrás do outro,
+ *   com o próximo ENABLE logo que o FLAG_DONE sobe;
+ * - o FLAG_DONE tem de cair depois de cada pulso: é o que o lib.s espera
+ *   (leitura de volta do PIO_ENABLE) antes de olhar os FLAGS.
+ *
+ * A mem1 é lida e escrita pela janela VRAM, como o HPS faz.
+ * Uso: make sim_packed (ver HPS/makefile). Sai com 1 se algo divergir.
+ *
+ */
+
+#include "Vmain.h"
+#include "verilated.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+enum { OP_STORE = 2, OP_RESET = 7 };
+enum { EXT_NONE = 0, EXT_PACKED = 1 };
+
+static const unsigned IMAGE_SIZE = 76800;
+static const uint64_t CMD_TIMEOUT = 200000;
+
+static VerilatedContext *ctx;
+static Vmain *top;
+static uint64_t cycles;
+static uint8_t ref[IMAGE_SIZE]; // o que a mem1 deveria ter
+static int failures;
+
+// Um ciclo de clk_100 (o modelo do pll repassa o refclk)
+static void tick(void) {
+    top->CLOCK_50 = 0;
+    top->eval();
+    top->CLOCK_50 = 1;
+    top->eval();
+    cycles++;
+    ctx->timeInc(1);
+}
+
+static void vram_write(uint32_t word, uint32_t data) {
+    top->VRAM_ADDRESS = word * 4;
+    top->VRAM_WRITEDATA = data;
+    top->VRAM_BYTEENABLE = 0xF;
+    top->VRAM_WRITE = 1;
+    for (;;) {
+        top->CLOCK_50 = 0;
+        top->eval();
+        int accepted = !top->VRAM_WAITREQUEST;
+        tick();
+        if (accepted) {
+            break;
+        }
+    }
+    top->VRAM_WRITE = 0;
+}
+
+// Uma palavra da mem1 (sem pipeline: a bancada não mede a janela)
+static uint32_t vram_read(uint32_t word) {
+    top->VRAM_ADDRESS = word * 4;
+    top->VRAM_READ = 1;
+    for (;;) {
+        top->CLOCK_50 = 0;
+        top->eval();
+        int accepted = !top->VRAM_WAITREQUEST;
+        tick();
+        if (accepted) {
+            break;
+        }
+    }
+    top->VRAM_READ = 0;
+    while (!top->VRAM_READDATAVALID) {
+        tick();
+    }
+    return top->VRAM_READDATA;
+}
+
+// Pulsa o ENABLE com o comando nas portas; devolve os ciclos até o FLAG_DONE
+// voltar a 1, ou 0 se ele não caiu ou não voltou
+static uint64_t command(unsigned op, unsigned addr, unsigned ext, uint8_t pixel, uint32_t packed) {
+    top->INSTRUCTION = op;
+    top->MEM_ADDR = addr & 0x1FFFF;
+    top->SEL_MEM = (op == OP_STORE);
+    top->DATA_IN = pixel;
+    top->EXT_OP = ext;
+    top->DATA_PACKED = packed;
+    top->ENABLE = 1;
+    tick();
+    top->ENABLE = 0;
+
+    uint64_t start = cycles;
+    while (top->FLAG_DONE && cycles - start < 8) {
+        tick();
+    }
+    if (top->FLAG_DONE) {
+        fprintf(stderr, "FALHA: FLAG_DONE não caiu após o ENABLE (op %u, endereço %u)\n", op, addr);
+        failures++;
+        return 0;
+    }
+    while (!top->FLAG_DONE && cycles - start < CMD_TIMEOUT) {
+        tick();
+    }
+    if (!top->FLAG_DONE) {
+        fprintf(stderr, "FALHA: timeout (op %u, endereço %u)\n", op, addr);
+        failures++;
+        return 0;
+    }
+    return cycles - start;
+}
+
+static uint64_t store_packed(unsigned addr, uint32_t pixels) {
+    uint64_t n = command(OP_STORE, addr, EXT_PACKED, 0, pixels);
+    if (addr < IMAGE_SIZE - 3) {
+        memcpy(&ref[addr], &pixels, 4); // pixel de menor endereço no byte 0 (host little-endian)
+    }
+    return n;
+}
+
+static uint64_t store(unsigned addr, uint8_t pixel) {
+    uint64_t n = command(OP_STORE, addr, EXT_NONE, pixel, 0);
+    if (addr < IMAGE_SIZE) {
+        ref[addr] = pixel;
+    }
+    return n;
+}
+
+// Confere as palavras [first, last] da mem1 com o modelo
+static void check_words(unsigned first, unsigned last, const char *what) {
+    for (unsigned w = first; w <= last && w < IMAGE_SIZE / 4; w++) {
+        uint32_t got = vram_read(w), want;
+        memcpy(&want, &ref[w * 4], 4);
+        if (got != want) {
+            fprintf(stderr, "FALHA: %s: palavra %u = %08x, esperado %08x\n", what, w, got, want);
+            failures++;
+            return;
+        }
+    }
+}
+
+// xorshift32: a mesma sequência em qualquer máquina
+static uint32_t rng_state = 2024;
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+int main(void) {
+    ctx = new VerilatedContext;
+    top = new Vmain{ctx};
+    top->ENABLE = 1; // sem o pulso espúrio da partida
+    top->VRAM_READ = 0;
+    top->VRAM_WRITE = 0;
+    for (int i = 0; i < 8; i++) {
+        tick();
+    }
+
+    // mem1 com um padrão conhecido (nenhum byte repetido numa palavra)
+    for (unsigned w = 0; w < IMAGE_SIZE / 4; w++) {
+        uint32_t v = 0x01020304u * (w % 61 + 1) ^ (w << 12);
+        vram_write(w, v);
+        memcpy(&ref[w * 4], &v, 4);
+    }
+
+    // os 4 alinhamentos no início, no meio e no fim da imagem
+    static const unsigned bases[] = {0, 38400, IMAGE_SIZE - 8};
+    uint64_t lat[4] = {0, 0, 0, 0};
+    for (unsigned b : bases) {
+        for (unsigned off = 0; off < 4; off++) {
+            unsigned addr = b + off;
+            char what[48];
+            snprintf(what, sizeof(what), "empacotado em %u (%% 4 = %u)", addr, off);
+            lat[off] = store_packed(addr, 0xA0B0C0D0u + addr);
+            check_words(addr / 4 ? addr / 4 - 1 : 0, addr / 4 + 2, what);
+        }
+    }
+    printf("STORE empacotado: %llu/%llu/%llu/%llu ciclos até o FLAG_DONE (endereço %% 4 = 0/1/2/3)\n",
+           (unsigned long long)lat[0], (unsigned long long)lat[1], (unsigned long long)lat[2],
+           (unsigned long long)lat[3]);
+
+    // limites: 76796 ainda cabe; 76797 em diante é erro e não escreve
+    store_packed(IMAGE_SIZE - 4, 0x11223344u);
+    check_words(IMAGE_SIZE / 4 - 2, IMAGE_SIZE / 4 - 1, "empacotado no último endereço");
+    if (top->FLAG_ERROR) {
+        fprintf(stderr, "FALHA: FLAG_ERROR no endereço %u\n", IMAGE_SIZE - 4);
+        failures++;
+    }
+    for (unsigned addr = IMAGE_SIZE - 3; addr < IMAGE_SIZE + 1; addr++) {
+        store_packed(addr, 0xDEADBEEFu);
+        if (!top->FLAG_ERROR) {
+            fprintf(stderr, "FALHA: sem FLAG_ERROR no endereço %u\n", addr);
+            failures++;
+        }
+        check_words(IMAGE_SIZE / 4 - 2, IMAGE_SIZE / 4 - 1, "empacotado fora da imagem");
+        command(OP_RESET, 0, EXT_NONE, 0, 0);
+        if (top->FLAG_ERROR) {
+            fprintf(stderr, "FALHA: o RESET não limpou o FLAG_ERROR\n");
+            failures++;
+        }
+    }
+
+    // rajada aleatória, empacotados e simples misturados
+    const unsigned n_random = 4000;
+    uint64_t total = 0;
+    for (unsigned i = 0; i < n_random; i++) {
+        uint32_t r = rng();
+        if (r & 3) {
+            total += store_packed(rng() % (IMAGE_SIZE - 3), rng());
+        } else {
+            total += store(rng() % IMAGE_SIZE, (uint8_t)rng());
+        }
+    }
+    check_words(0, IMAGE_SIZE / 4 - 1, "rajada aleatória");
+    printf("rajada: %u STOREs, %.2f ciclos em média até o FLAG_DONE\n", n_random, (double)total / n_random);
+
+    top->final();
+    delete top;
+    delete ctx;
+    if (failures) {
+        fprintf(stderr, "%d falha(s)\n", failures);
+        return 1;
+    }
+    printf("STORE empacotado: OK\n");
+    return 0;
+}
@@ -1,51 +0,0 @@
-#ifndef __ALT_TYPES_H__
-#define __ALT_TYPES_H__
-
-/*
-* Copyright Altera Corporation (C) 2012-2014. All rights reserved
-*
-* SPDX-License-Identifier:  BSD-3-Clause
-*
-* Redistribution and use in source and binary forms, with or without
-* modification, are permitted provided that the following conditions are met:
-*  * Redistributions of source code must retain the above copyright
-*  notice, this list of conditions and the following disclaimer.
-*  * Redistributions in binary form must reproduce the above copyright
-*  notice, this list of conditions and the following disclaimer in the
-*  documentation and/or other materials provided with the distribution.
-*  * Neither the name of Altera Corporation nor the
-*  names of its contributors may be used to endorse or promote products
-*  derived from this software without specific prior written permission.
-*
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL ALTERA CORPORATION BE LIABLE FOR ANY
-* DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-* SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-
-/* 
- * Don't declare these typedefs if this file is included by assembly source.
- */
-#ifndef ALT_ASM_SRC
-typedef signed char  alt_8;
-typedef unsigned char  alt_u8;
-typedef signed short alt_16;
-typedef unsigned short alt_u16;
-typedef signed long alt_32;
-typedef unsigned long alt_u32;
-typedef long long alt_64;
-typedef unsigned long long alt_u64;
-#endif
-
-#define ALT_INLINE        __inline__
-#define ALT_ALWAYS_INLINE __attribute__ ((always_inline))
-#define ALT_WEAK          __attribute__((weak))
-
-#endif /* __ALT_TYPES_H__ */
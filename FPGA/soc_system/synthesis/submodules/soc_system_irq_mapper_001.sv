@@ -1,57 +0,0 @@
-// (C) 2001-2023 Intel Corporation. All rights reserved.
-// Your use of Intel Corporation's design tools, logic functions and other 
-// software and tools, and its AMPP partner logic functions, and any output 
-// files from any of the foregoing (including device programming or simulation 
-// files), and any associated documentation or information are expressly subject 
-// to the terms and conditions of the Intel Program License Subscription 
-// Agreement, Intel FPGA IP License Agreement, or other applicable 
-// license agreement, including, without limitation, that your use is for the 
-// sole purpose of programming logic devices manufactured by Intel and sold by 
-// Intel or its authorized distributors.  Please refer to the applicable 
-// agreement for further details.
-
-
-// $Id: //acds/rel/23.1std/ip/merlin/altera_irq_mapper/altera_irq_mapper.sv.terp#1 $
-// $Revision: #1 $
-// $Date: 2022/10/30 $
-// $Author: psgswbuild $
-
-// -------------------------------------------------------
-// Altera IRQ Mapper
-//
-// Parameters
-//   NUM_RCVRS        : 0
-//   SENDER_IRW_WIDTH : 32
-//   IRQ_MAP          : 
-//
-// -------------------------------------------------------
-
-`timescale 1 ns / 1 ns
-
-module soc_system_irq_mapper_001
-(
-    // -------------------
-    // Clock & Reset
-    // -------------------
-    input clk,
-    input reset,
-
-    // -------------------
-    // IRQ Receivers
-    // -------------------
-
-    // -------------------
-    // Command Source (Output)
-    // -------------------
-    output reg [31 : 0] sender_irq
-);
-
-    initial sender_irq = 0;
-
-    always @* begin
-	sender_irq = 0;
-
-    end
-
-endmodule
-
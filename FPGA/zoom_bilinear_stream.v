@@ -0,0 +1,279 @@
+module zoom_bilinear_stream(
+    input             clock,
+
+    // Controle (vindo da FSM do main)
+    input             start,        // pulso: gera um quadro inteiro
+    input      [2:0]  zoom,         // nível de destino: 5..7 (2x, 4x, 8x)
+    input      [8:0]  org_x,        // origem da janela de origem, como no zoom_stream.v
+    input      [7:0]  org_y,
+    output reg        busy,
+    output reg        done,         // pulso de 1 ciclo: a última escrita sai no ciclo seguinte
+
+    // Porta de leitura da mem1 (palavras de 4 pixels, latência de 2 ciclos)
+    output     [14:0] rd_addr,
+    input      [31:0] rd_data,
+
+    // Porta de escrita do buffer de trás (palavras inteiras)
+    output reg [14:0] wr_addr,
+    output reg [31:0] wr_data,
+    output reg        wr_en
+);
+
+    //================================================================
+    // Zoom in bilinear (BilinearZoom): com a mesma origem (cx, cy) do
+    // zoom_stream.v, saída(x, y) interpola mem1 entre (sx, sy) e
+    // (sx + 1, sy + 1), sx = cx + (x >> s), com pesos em oitavos
+    // (na borda direita e na de baixo o vizinho é o próprio pixel):
+    //   wx = (x mod 2^s) << (3 - s), wy idem
+    //   saída = ((8-wx)(8-wy) p00 + wx(8-wy) p01 + (8-wx)wy p10 + wx wy p11 + 32) >> 6
+    // Com wx = wy = 0 sai o pixel do vizinho mais próximo.
+    //
+    // Cache de 2 linhas: as linhas de origem sy e sy + 1 ficam em dois
+    // pares de bancos de 16 bits (pares de pixels pares/ímpares da
+    // palavra), então os 4 pixels saem numa leitura por ciclo. Um pixel
+    // de saída por ciclo; quando a linha de origem avança, a nova linha
+    // (só as palavras da janela) é lida da mem1 por cima da que saiu,
+    // com a saída parada. Ciclos por quadro: 76800 mais ~44 por linha de
+    // origem (~82000 no 2x, 0,82 ms).
+    //================================================================
+    localparam P_IDLE = 2'd0, P_LOAD = 2'd1, P_WAIT = 2'd2, P_ROW = 2'd3;
+
+    reg [1:0]  phase;
+    reg [1:0]  s;            // fator 2^s
+    reg [2:0]  mask;         // 2^s - 1
+    reg [8:0]  cx;
+    reg [7:0]  cy;
+    reg [6:0]  ws, we;       // palavras da janela de origem numa linha
+
+    //----------------------------------------------------------------
+    // Cache de 2 linhas: palavra w da linha em e*[w] (pixels 0 e 1) e
+    // o*[w] (pixels 2 e 3)
+    //----------------------------------------------------------------
+    reg [15:0] e0 [0:79];
+    reg [15:0] o0 [0:79];
+    reg [15:0] e1 [0:79];
+    reg [15:0] o1 [0:79];
+    reg        top;          // linha da cache com sy (a outra tem sy + 1)
+
+    // carga de uma linha de origem
+    reg [7:0]  ld_row;
+    reg [6:0]  ld_w;
+    reg        ld_line;
+    reg        ld_init;      // carga inicial: falta a linha de baixo
+    reg        ldv_p1, ldv_p2, ldlast_p1, ldlast_p2, ldline_p1, ldline_p2;
+    reg [6:0]  ldw_p1, ldw_p2;
+
+    wire [14:0] row_word = {ld_row, 6'b0} + {ld_row, 4'b0};  // ld_row * 80
+    assign rd_addr = row_word + ld_w;
+
+    //----------------------------------------------------------------
+    // Estágio 0: pixel de saída (x, y) e leitura da cache
+    //----------------------------------------------------------------
+    reg [8:0]  x;
+    reg [7:0]  y;
+
+    wire [8:0] sx   = cx + (x >> s);
+    wire [2:0] wx   = (sx == 9'd319) ? 3'd0 : (x[2:0] & mask) << (3'd3 - s);
+    wire [2:0] wy   = (y[2:0] & mask) << (3'd3 - s);
+    wire [6:0] m    = sx[8:2];
+    wire [6:0] ea   = (sx[1] && m != 7'd79) ? m + 1'b1 : m;    // par seguinte, na palavra seguinte
+    wire       issue = phase == P_ROW;
+    wire       row_end = x == 9'd319;
+
+    reg        v_p1, last_p1, h_p1, odd_p1, top_p1;
+    reg [2:0]  wx_p1, wy_p1;
+    reg [15:0] e0q, o0q, e1q, o1q;
+
+    //----------------------------------------------------------------
+    // Estágio 1: os 4 pixels e os produtos pelos pesos
+    //----------------------------------------------------------------
+    wire [15:0] a0 = h_p1 ? o0q : e0q;     // par com sx
+    wire [15:0] b0 = h_p1 ? e0q : o0q;     // par com sx + 1 (se sx é ímpar)
+    wire [15:0] a1 = h_p1 ? o1q : e1q;
+    wire [15:0] b1 = h_p1 ? e1q : o1q;
+
+    wire [7:0] l0_p0 = odd_p1 ? a0[15:8] : a0[7:0];
+    wire [7:0] l0_p1 = odd_p1 ? b0[7:0]  : a0[15:8];
+    wire [7:0] l1_p0 = odd_p1 ? a1[15:8] : a1[7:0];
+    wire [7:0] l1_p1 = odd_p1 ? b1[7:0]  : a1[15:8];
+
+    wire [7:0] p00 = top_p1 ? l1_p0 : l0_p0;
+    wire [7:0] p01 = top_p1 ? l1_p1 : l0_p1;
+    wire [7:0] p10 = top_p1 ? l0_p0 : l1_p0;
+    wire [7:0] p11 = top_p1 ? l0_p1 : l1_p1;
+
+    wire [3:0] wa = 4'd8 - wx_p1;
+    wire [3:0] wc = 4'd8 - wy_p1;
+
+    reg        v_p2, last_p2;
+    reg [14:0] m00, m01, m10, m11;
+
+    //----------------------------------------------------------------
+    // Estágio 2: soma com arredondamento e montagem das palavras
+    //----------------------------------------------------------------
+    wire [15:0] acc = m00 + m01 + m10 + m11 + 16'd32;
+    wire [7:0]  pix = acc[13:6];
+
+    reg [16:0] opix;
+    reg [23:0] word_lo;
+
+    initial begin
+        phase  = P_IDLE;
+        busy   = 1'b0;
+        done   = 1'b0;
+        wr_en  = 1'b0;
+        ldv_p1 = 1'b0;
+        ldv_p2 = 1'b0;
+        v_p1   = 1'b0;
+        v_p2   = 1'b0;
+    end
+
+    always @(posedge clock) begin
+        done <= 1'b0;
+
+        //------------------------------------------------------------
+        // Sequência das linhas
+        //------------------------------------------------------------
+        case (phase)
+            P_IDLE: begin
+                if (start) begin
+                    busy    <= 1'b1;
+                    x       <= 9'd0;
+                    y       <= 8'd0;
+                    top     <= 1'b0;
+                    opix    <= 17'd0;
+                    ld_line <= 1'b0;
+                    ld_init <= 1'b1;
+                    phase   <= P_LOAD;
+                    cx      <= org_x;
+                    cy      <= org_y;
+                    ld_row  <= org_y;
+                    ws      <= org_x[8:2];
+                    ld_w    <= org_x[8:2];
+                    // palavras dos pixels org_x .. org_x + (320 >> s), até a 79
+                    case (zoom)
+                        3'b101: begin
+                            s <= 2'd1; mask <= 3'd1;
+                            we <= (org_x > 9'd159) ? 7'd79 : org_x[8:2] + 7'd40;
+                        end
+                        3'b110: begin
+                            s <= 2'd2; mask <= 3'd3;
+                            we <= (org_x > 9'd239) ? 7'd79 : org_x[8:2] + 7'd20;
+                        end
+                        default: begin
+                            s <= 2'd3; mask <= 3'd7;
+                            we <= (org_x > 9'd279) ? 7'd79 : org_x[8:2] + 7'd10;
+                        end
+                    endcase
+                end
+            end
+
+            P_LOAD: begin
+                if (ld_w == we) begin
+                    phase <= P_WAIT;
+                end else begin
+                    ld_w <= ld_w + 1'b1;
+                end
+            end
+
+            P_WAIT: begin
+                // a última palavra da linha é escrita neste ciclo
+                if (ldv_p2 && ldlast_p2) begin
+                    ld_w <= ws;
+                    if (ld_init) begin
+                        ld_init <= 1'b0;
+                        ld_row  <= ld_row + 1'b1;
+                        ld_line <= 1'b1;
+                        phase   <= P_LOAD;
+                    end else begin
+                        phase <= P_ROW;
+                    end
+                end
+            end
+
+            P_ROW: begin
+                if (row_end) begin
+                    x <= 9'd0;
+                    y <= y + 1'b1;
+                    if (y == 8'd239) begin
+                        phase <= P_IDLE;
+                    end else if ((y[2:0] & mask) == mask) begin
+                        // a linha de origem avança: sy + 2 entra no lugar de sy
+                        ld_row  <= (cy + ((y + 1'b1) >> s) == 8'd239) ? 8'd239 : cy + ((y + 1'b1) >> s) + 1'b1;
+                        ld_line <= top;
+                        top     <= !top;
+                        phase   <= P_LOAD;
+                    end
+                end else begin
+                    x <= x + 1'b1;
+                end
+            end
+        endcase
+
+        //------------------------------------------------------------
+        // Carga: escreve a palavra lida há 2 ciclos na cache
+        //------------------------------------------------------------
+        ldv_p1    <= phase == P_LOAD;
+        ldw_p1    <= ld_w;
+        ldlast_p1 <= ld_w == we;
+        ldline_p1 <= ld_line;
+        ldv_p2    <= ldv_p1;
+        ldw_p2    <= ldw_p1;
+        ldlast_p2 <= ldlast_p1;
+        ldline_p2 <= ldline_p1;
+
+        if (ldv_p2) begin
+            if (ldline_p2) begin
+                e1[ldw_p2] <= rd_data[15:0];
+                o1[ldw_p2] <= rd_data[31:16];
+            end else begin
+                e0[ldw_p2] <= rd_data[15:0];
+                o0[ldw_p2] <= rd_data[31:16];
+            end
+        end
+
+        //------------------------------------------------------------
+        // Estágio 0 -> 1
+        //------------------------------------------------------------
+        e0q     <= e0[ea];
+        o0q     <= o0[m];
+        e1q     <= e1[ea];
+        o1q     <= o1[m];
+        v_p1    <= issue;
+        last_p1 <= issue && row_end && y == 8'd239;
+        h_p1    <= sx[1];
+        odd_p1  <= sx[0];
+        top_p1  <= top;
+        wx_p1   <= wx;
+        wy_p1   <= wy;
+
+        //------------------------------------------------------------
+        // Estágio 1 -> 2
+        //------------------------------------------------------------
+        v_p2    <= v_p1;
+        last_p2 <= last_p1;
+        m00     <= p00 * (wa * wc);
+        m01     <= p01 * (wx_p1 * wc);
+        m10     <= p10 * (wa * wy_p1);
+        m11     <= p11 * (wx_p1 * wy_p1);
+
+        //------------------------------------------------------------
+        // Estágio 2: escrita no buffer de trás
+        //------------------------------------------------------------
+        wr_en <= 1'b0;
+        if (v_p2) begin
+            word_lo <= {pix, word_lo[23:8]};
+            opix    <= opix + 1'b1;
+            if (opix[1:0] == 2'd3) begin
+                wr_en   <= 1'b1;
+                wr_addr <= opix[16:2];
+                wr_data <= {pix, word_lo};
+            end
+            if (last_p2) begin
+                busy <= 1'b0;
+                done <= 1'b1;
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,291 @@
+module zoom_out_stream(
+    input             clock,
+
+    // Controle (vindo da FSM do main)
+    input             start,        // pulso: gera um quadro inteiro
+    input             average,      // 0: decimação (NH), 1: média de blocos (BA)
+    input      [2:0]  zoom,         // nível de destino: 3, 2, 1 (1/2, 1/4, 1/8)
+    input      [6:0]  win_w,        // canto da janela de saída: palavra da coluna
+    input      [7:0]  win_y,        // e linha (o main já recorta na tela)
+    output reg        busy,
+    output reg        done,         // pulso de 1 ciclo: a última escrita sai no ciclo seguinte
+
+    // Porta de leitura da mem1 (palavras de 4 pixels, latência de 2 ciclos)
+    output     [14:0] rd_addr,
+    input      [31:0] rd_data,
+
+    // Porta de escrita do buffer de trás (palavras inteiras)
+    output reg [14:0] wr_addr,
+    output reg [31:0] wr_data,
+    output reg        wr_en
+);
+
+    //================================================================
+    // Zoom out numa passada só pela mem1 (fator 2^s, bloco B = 2^s)
+    //
+    // A origem é varrida em ordem, uma palavra por ciclo, e cada pixel é
+    // lido uma vez só. Uma palavra de saída (4 pixels) cobre B palavras
+    // de origem numa linha e B linhas:
+    //  - na horizontal, hsum soma as B palavras do grupo (pares de
+    //    pixels no 1/2, a palavra inteira no 1/4 e no 1/8);
+    //  - na vertical, line_buf guarda a soma parcial de cada palavra de
+    //    saída da faixa de B linhas (40, 20 ou 10 entradas de 4 x 14 bits,
+    //    uma BRAM pequena); na última linha do bloco sai a média
+    //    soma >> 2s e a palavra é escrita.
+    // Na decimação vale só o pixel (0,0) do bloco: a palavra de saída sai
+    // na primeira linha do bloco, sem line_buf.
+    //
+    // A janela de saída começa em (win_w palavras, win_y linhas), posta
+    // pelo main a partir do centro do zoom; as palavras fora dela recebem
+    // 0 nos ciclos em que a passada não escreve. Ciclos por quadro: ~19200 (0,19 ms) em todos
+    // os níveis, nos dois algoritmos.
+    //================================================================
+    localparam LAST_WORD = 15'd19199;
+
+    reg        avg_r;
+    reg [1:0]  s;
+    reg [2:0]  mask;         // B - 1
+    reg [6:0]  w_lo, w_hi;   // janela de saída, em palavras
+    reg [9:0]  y_lo, y_hi;
+    reg [6:0]  w_span;       // palavras da janela por linha
+
+    //----------------------------------------------------------------
+    // Passada pela origem
+    //----------------------------------------------------------------
+    reg        running;
+    reg [14:0] src;          // palavra lida (linha * 80 + coluna)
+    reg [6:0]  sw;           // coluna da palavra de origem
+    reg [2:0]  sy;           // linha dentro do bloco
+    reg [14:0] out_base;     // palavra de saída da coluna 0 da faixa
+
+    assign rd_addr = src;
+
+    wire [2:0] gpos = sw[2:0] & mask;       // palavra dentro do grupo
+    wire [5:0] ow   = sw >> s;              // palavra de saída na faixa
+
+    // slots lidos há 1 e 2 ciclos
+    reg        valid_p1, valid_p2;
+    reg [2:0]  gpos_p1, gpos_p2;
+    reg        glast_p1, glast_p2;
+    reg        rfirst_p1, rfirst_p2;
+    reg        rlast_p1, rlast_p2;
+    reg [5:0]  ow_p1, ow_p2;
+    reg [14:0] out_p1, out_p2;
+    reg        last_p1, last_p2;
+
+    // line_buf: soma vertical parcial de cada palavra de saída (M10K)
+    reg [55:0] line_buf [0:39];
+    reg [55:0] lb_q;
+
+    // soma horizontal das palavras já lidas do grupo
+    reg [10:0] hsum [0:3];
+
+    wire [7:0] b0 = rd_data[7:0];
+    wire [7:0] b1 = rd_data[15:8];
+    wire [7:0] b2 = rd_data[23:16];
+    wire [7:0] b3 = rd_data[31:24];
+
+    wire [10:0] pair_lo = avg_r ? b0 + b1 : b0;
+    wire [10:0] pair_hi = avg_r ? b2 + b3 : b2;
+    wire [10:0] quad    = avg_r ? pair_lo + pair_hi : b0;
+
+    // hsum com a palavra que chega agora
+    reg [10:0] hnext [0:3];
+    integer i;
+    always @(*) begin
+        for (i = 0; i < 4; i = i + 1) begin
+            hnext[i] = hsum[i];
+        end
+        case (s)
+            2'd1: begin
+                hnext[{gpos_p2[0], 1'b0}] = pair_lo;
+                hnext[{gpos_p2[0], 1'b1}] = pair_hi;
+            end
+            2'd2: hnext[gpos_p2[1:0]] = quad;
+            default: begin
+                // duas palavras por pixel de saída; na decimação vale só a primeira
+                if (!gpos_p2[0]) begin
+                    hnext[gpos_p2[2:1]] = quad;
+                end else if (avg_r) begin
+                    hnext[gpos_p2[2:1]] = hsum[gpos_p2[2:1]] + quad;
+                end
+            end
+        endcase
+    end
+
+    // soma vertical com a linha que termina agora
+    wire [13:0] vsum0 = (rfirst_p2 ? 14'd0 : lb_q[13:0])  + hnext[0];
+    wire [13:0] vsum1 = (rfirst_p2 ? 14'd0 : lb_q[27:14]) + hnext[1];
+    wire [13:0] vsum2 = (rfirst_p2 ? 14'd0 : lb_q[41:28]) + hnext[2];
+    wire [13:0] vsum3 = (rfirst_p2 ? 14'd0 : lb_q[55:42]) + hnext[3];
+
+    wire [3:0]  div = {s, 1'b0};            // 2s
+    wire [13:0] avg0 = vsum0 >> div;
+    wire [13:0] avg1 = vsum1 >> div;
+    wire [13:0] avg2 = vsum2 >> div;
+    wire [13:0] avg3 = vsum3 >> div;
+
+    wire out_now = valid_p2 && glast_p2 && (avg_r ? rlast_p2 : rfirst_p2);
+
+    //----------------------------------------------------------------
+    // Preenchimento com 0 fora da janela
+    //----------------------------------------------------------------
+    reg        zeroing;
+    reg [14:0] zaddr;
+    reg [6:0]  zw;
+    reg [9:0]  zy;
+    reg        pass_end, zero_end;
+
+    // próxima palavra; se ela abre a janela, pula a janela inteira (na
+    // borda direita, para o começo da linha seguinte)
+    wire [6:0]  zc_w   = (zw == 7'd79) ? 7'd0 : zw + 1'b1;
+    wire [9:0]  zc_y   = (zw == 7'd79) ? zy + 1'b1 : zy;
+    wire        zc_in  = zc_y >= y_lo && zc_y <= y_hi && zc_w == w_lo;
+    wire [15:0] zaddr_n = zaddr + 1'b1 + (zc_in ? w_span : 7'd0);
+
+    wire zero_now = zeroing && !out_now;
+    wire zero_last = zero_now && zaddr_n > LAST_WORD;
+
+    wire pass_fin = pass_end || (valid_p2 && last_p2);
+    wire zero_fin = zero_end || zero_last;
+
+    initial begin
+        busy     = 1'b0;
+        done     = 1'b0;
+        running  = 1'b0;
+        zeroing  = 1'b0;
+        wr_en    = 1'b0;
+        valid_p1 = 1'b0;
+        valid_p2 = 1'b0;
+    end
+
+    always @(posedge clock) begin
+        done <= 1'b0;
+
+        //------------------------------------------------------------
+        // Estágio 0: gerador de endereços (e configuração no start)
+        //------------------------------------------------------------
+        if (start && !busy) begin
+            busy     <= 1'b1;
+            running  <= 1'b1;
+            zeroing  <= 1'b1;
+            pass_end <= 1'b0;
+            zero_end <= 1'b0;
+            avg_r    <= average;
+            src      <= 15'd0;
+            sw       <= 7'd0;
+            sy       <= 3'd0;
+            zy       <= 10'd0;
+            w_lo     <= win_w;
+            y_lo     <= win_y;
+            out_base <= {win_y, 6'b0} + {win_y, 4'b0} + win_w;   // win_y * 80 + win_w
+            case (zoom)
+                3'b011: begin
+                    s <= 2'd1; mask <= 3'd1; w_span <= 7'd40;
+                    w_hi <= win_w + 7'd39; y_hi <= win_y + 10'd119;
+                    zw   <= (win_w == 7'd0 && win_y == 8'd0) ? 7'd40 : 7'd0;
+                    zaddr <= (win_w == 7'd0 && win_y == 8'd0) ? 15'd40 : 15'd0;
+                end
+                3'b010: begin
+                    s <= 2'd2; mask <= 3'd3; w_span <= 7'd20;
+                    w_hi <= win_w + 7'd19; y_hi <= win_y + 10'd59;
+                    zw   <= (win_w == 7'd0 && win_y == 8'd0) ? 7'd20 : 7'd0;
+                    zaddr <= (win_w == 7'd0 && win_y == 8'd0) ? 15'd20 : 15'd0;
+                end
+                default: begin
+                    s <= 2'd3; mask <= 3'd7; w_span <= 7'd10;
+                    w_hi <= win_w + 7'd9;  y_hi <= win_y + 10'd29;
+                    zw   <= (win_w == 7'd0 && win_y == 8'd0) ? 7'd10 : 7'd0;
+                    zaddr <= (win_w == 7'd0 && win_y == 8'd0) ? 15'd10 : 15'd0;
+                end
+            endcase
+        end else if (running) begin
+            src <= src + 1'b1;
+            if (sw == 7'd79) begin
+                sw <= 7'd0;
+                sy <= (sy == mask) ? 3'd0 : sy + 1'b1;
+                if (sy == mask) begin
+                    out_base <= out_base + 15'd80;
+                end
+            end else begin
+                sw <= sw + 1'b1;
+            end
+            if (src == LAST_WORD) begin
+                running <= 1'b0;
+            end
+        end
+
+        //------------------------------------------------------------
+        // Estágios 1 e 2: espera a leitura da mem1; a entrada da
+        // line_buf é lida junto, um ciclo antes do uso
+        //------------------------------------------------------------
+        valid_p1  <= running;
+        gpos_p1   <= gpos;
+        glast_p1  <= gpos == mask;
+        rfirst_p1 <= sy == 3'd0;
+        rlast_p1  <= sy == mask;
+        ow_p1     <= ow;
+        out_p1    <= out_base + ow;
+        last_p1   <= src == LAST_WORD;
+
+        valid_p2  <= valid_p1;
+        gpos_p2   <= gpos_p1;
+        glast_p2  <= glast_p1;
+        rfirst_p2 <= rfirst_p1;
+        rlast_p2  <= rlast_p1;
+        ow_p2     <= ow_p1;
+        out_p2    <= out_p1;
+        last_p2   <= last_p1;
+
+        lb_q <= line_buf[ow_p1];
+
+        //------------------------------------------------------------
+        // Estágio 3: somas, line_buf e escrita no buffer de trás
+        //------------------------------------------------------------
+        if (valid_p2) begin
+            for (i = 0; i < 4; i = i + 1) begin
+                hsum[i] <= hnext[i];
+            end
+            if (avg_r && glast_p2 && !rlast_p2) begin
+                line_buf[ow_p2] <= {vsum3, vsum2, vsum1, vsum0};
+            end
+        end
+
+        if (out_now) begin
+            wr_en   <= 1'b1;
+            wr_addr <= out_p2;
+            if (avg_r) begin
+                wr_data <= {avg3[7:0], avg2[7:0], avg1[7:0], avg0[7:0]};
+            end else begin
+                wr_data <= {hnext[3][7:0], hnext[2][7:0], hnext[1][7:0], hnext[0][7:0]};
+            end
+        end else begin
+            wr_en   <= zero_now;
+            wr_addr <= zaddr;
+            wr_data <= 32'd0;
+        end
+
+        if (zero_now) begin
+            if (zero_last) begin
+                zeroing <= 1'b0;
+            end else if (zc_in && w_hi == 7'd79) begin
+                zw    <= 7'd0;
+                zy    <= zc_y + 1'b1;
+            end else begin
+                zw    <= zc_in ? w_hi + 1'b1 : zc_w;
+                zy    <= zc_y;
+            end
+            zaddr <= zaddr_n[14:0];
+        end
+
+        if (busy) begin
+            pass_end <= pass_fin;
+            zero_end <= zero_fin;
+            if (pass_fin && zero_fin) begin
+                busy <= 1'b0;
+                done <= 1'b1;
+            end
+        end
+    end
+
+endmodule
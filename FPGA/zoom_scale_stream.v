@@ -0,0 +1,297 @@
+module zoom_scale_stream(
+    input             clock,
+
+    // Controle (vindo da FSM do main)
+    input             start,        // pulso: gera um quadro inteiro
+    input      [15:0] scale,        // fator em 8.8 (0x0100 = 1x), de 0x0020 (1/8) a 0x0800 (8x)
+    input      [8:0]  center_x,     // pixel da mem1 no centro da tela
+    input      [7:0]  center_y,
+    output reg        busy,
+    output reg        done,         // pulso de 1 ciclo: a última escrita sai no ciclo seguinte
+
+    // Porta de leitura da mem1 (palavras de 4 pixels, latência de 2 ciclos)
+    output     [14:0] rd_addr,
+    input      [31:0] rd_data,
+
+    // Porta de escrita do buffer de trás (palavras inteiras)
+    output reg [14:0] wr_addr,
+    output reg [31:0] wr_data,
+    output reg        wr_en
+);
+
+    //================================================================
+    // Zoom com fator fracionário, centrado em (center_x, center_y)
+    //
+    // O pixel de saída x começa na origem ax = center_x - 160/scale +
+    // x/scale (Q16, com sinal), recortada para a vista não sair da imagem
+    // (no zoom in) nem a imagem sair da tela (no zoom out); o passo
+    // 1/scale sai de um divisor serial no start (25 ciclos) e os
+    // endereços andam por soma, sem multiplicadores. Na vertical vale o
+    // mesmo com center_y e 120.
+    //  - scale >= 1: vizinho mais próximo, mem1(floor(ax), floor(ay));
+    //  - scale <  1: média da área, os pixels de origem de
+    //    [ceil(ax), ceil(ax + 1/scale)) x [ceil(ay), ceil(ay + 1/scale))
+    //    (até 8 x 8); a divisão pela contagem é um produto pelo
+    //    recíproco de uma tabela. Área fora da imagem dá 0.
+    // Nas potências de 2, com o centro em (160,120), o resultado é o do
+    // NHI/PR e o da média de blocos do BA.
+    //
+    // Um pixel de origem lido por ciclo: o estágio A calcula a área do
+    // próximo pixel de saída enquanto o B lê a do atual. Ciclos por
+    // quadro: 76800 no zoom in; no zoom out, os pixels de origem na
+    // janela mais um por pixel de saída fora dela (~134000 no 1/2).
+    //================================================================
+
+    reg        dividing;
+    reg        setup, setup2;
+    reg [8:0]  cx_r;
+    reg [7:0]  cy_r;
+    reg signed [29:0] ex, ey;   // 320 - 320 * step e 240 - 240 * step: limites da origem
+    reg [15:0] scale_r;
+    reg        up;           // scale >= 1: vizinho mais próximo
+
+    //----------------------------------------------------------------
+    // Divisor serial: step = 2^24 / scale (1/scale em Q16, até 8.0)
+    //----------------------------------------------------------------
+    reg [4:0]  div_i;
+    reg [15:0] rem;
+    reg [19:0] step;
+
+    wire [16:0] div_sh = {rem, div_i == 5'd24};
+    wire        div_ge = div_sh >= {1'b0, scale_r};
+
+    //----------------------------------------------------------------
+    // Estágio A: área do próximo pixel de saída
+    //----------------------------------------------------------------
+    reg signed [29:0] ax, ay, ax0;
+    reg        [8:0]  nx;
+    reg        [7:0]  ny;
+    reg               a_valid;
+
+    wire signed [29:0] ax_n = ax + $signed({10'd0, step});
+    wire signed [29:0] ay_n = ay + $signed({10'd0, step});
+
+    // floor e ceil da parte inteira (Q16 -> inteiro com sinal)
+    wire signed [13:0] fx  = ax >>> 16;
+    wire signed [13:0] fy  = ay >>> 16;
+    wire signed [13:0] cx  = (ax + 30'sd65535) >>> 16;
+    wire signed [13:0] cy  = (ay + 30'sd65535) >>> 16;
+    wire signed [13:0] cxn = (ax_n + 30'sd65535) >>> 16;
+    wire signed [13:0] cyn = (ay_n + 30'sd65535) >>> 16;
+
+    wire signed [13:0] lo_x = up ? fx : cx;
+    wire signed [13:0] hi_x = up ? fx + 14'sd1 : cxn;
+    wire signed [13:0] lo_y = up ? fy : cy;
+    wire signed [13:0] hi_y = up ? fy + 14'sd1 : cyn;
+
+    // recorte na imagem: [0, 320) x [0, 240)
+    wire [8:0] lo_xc = lo_x < 0 ? 9'd0 : lo_x > 14'sd320 ? 9'd320 : lo_x[8:0];
+    wire [8:0] hi_xc = hi_x < 0 ? 9'd0 : hi_x > 14'sd320 ? 9'd320 : hi_x[8:0];
+    wire [7:0] lo_yc = lo_y < 0 ? 8'd0 : lo_y > 14'sd240 ? 8'd240 : lo_y[7:0];
+    wire [7:0] hi_yc = hi_y < 0 ? 8'd0 : hi_y > 14'sd240 ? 8'd240 : hi_y[7:0];
+
+    wire       a_empty = hi_xc <= lo_xc || hi_yc <= lo_yc;
+    wire [3:0] cnt_x   = hi_xc - lo_xc;
+    wire [3:0] cnt_y   = hi_yc - lo_yc;
+    wire       a_final = nx == 9'd319 && ny == 8'd239;
+
+    //----------------------------------------------------------------
+    // Estágio B: percorre a área do pixel atual, um pixel por ciclo
+    //----------------------------------------------------------------
+    reg        b_active;
+    reg [8:0]  xl, xh, c;    // colunas [xl, xh]
+    reg [7:0]  yl, yh, r;    // linhas [yl, yh]
+    reg        b_empty, b_final;
+    reg [6:0]  b_area;
+
+    wire        b_last = b_active && (b_empty || (c == xh && r == yh));
+    wire [16:0] src    = {r, 8'b0} + {r, 6'b0} + c;     // r * 320 + c
+
+    assign rd_addr = src[16:2];
+
+    // leituras de há 1 e 2 ciclos
+    reg        valid_p1, valid_p2;
+    reg        first_p1, first_p2;
+    reg        last_p1, last_p2;
+    reg        empty_p1, empty_p2;
+    reg        final_p1, final_p2;
+    reg [1:0]  lane_p1, lane_p2;
+    reg [6:0]  area_p1, area_p2;
+
+    //----------------------------------------------------------------
+    // Estágios 3 e 4: soma da área, divisão e montagem das palavras
+    //----------------------------------------------------------------
+    reg [13:0] acc;
+    reg        v_p3, final_p3, empty_p3;
+    reg [13:0] sum_p3;
+    reg [6:0]  area_p3;
+    reg [16:0] opix;         // pixel de saída da vez
+    reg [23:0] word_lo;      // pixels já montados da palavra
+
+    wire [7:0]  pix     = rd_data >> {lane_p2, 3'b000};
+    wire [13:0] sum_now = first_p2 ? pix : acc + pix;
+
+    // recip[n] = ceil(2^20 / n): (soma * recip[n]) >> 20 é floor(soma / n)
+    reg  [20:0] recip [1:64];
+    integer k;
+    initial begin
+        for (k = 1; k <= 64; k = k + 1) begin
+            recip[k] = (21'd1048576 + k - 1) / k;
+        end
+    end
+
+    wire [34:0] prod = sum_p3 * recip[area_p3];
+    wire [7:0]  avg  = empty_p3 ? 8'd0 : prod[27:20];
+
+    initial begin
+        busy     = 1'b0;
+        done     = 1'b0;
+        dividing = 1'b0;
+        setup    = 1'b0;
+        setup2   = 1'b0;
+        a_valid  = 1'b0;
+        b_active = 1'b0;
+        wr_en    = 1'b0;
+        valid_p1 = 1'b0;
+        valid_p2 = 1'b0;
+        v_p3     = 1'b0;
+    end
+
+    always @(posedge clock) begin
+        done <= 1'b0;
+
+        if (start && !busy) begin
+            busy     <= 1'b1;
+            dividing <= 1'b1;
+            scale_r  <= scale;
+            cx_r     <= center_x;
+            cy_r     <= center_y;
+            up       <= scale >= 16'h0100;
+            div_i    <= 5'd24;
+            rem      <= 16'd0;
+            step     <= 20'd0;
+            opix     <= 17'd0;
+        end else if (dividing) begin
+            // divisor restaurador, um bit do quociente por ciclo
+            rem   <= div_ge ? div_sh - scale_r : div_sh[15:0];
+            step  <= {step[18:0], div_ge};
+            div_i <= div_i - 1'b1;
+            if (div_i == 5'd0) begin
+                dividing <= 1'b0;
+                setup    <= 1'b1;
+            end
+        end else if (setup) begin
+            // origem: cx - 160 * step e cy - 120 * step, por deslocamentos
+            setup   <= 1'b0;
+            setup2  <= 1'b1;
+            ax0     <= $signed({5'b0, cx_r, 16'b0}) - $signed({3'b0, step, 7'b0}) - $signed({5'b0, step, 5'b0});
+            ay      <= $signed({6'b0, cy_r, 16'b0}) - $signed({3'b0, step, 7'b0}) + $signed({7'b0, step, 3'b0});
+            ex      <= (30'sd320 <<< 16) - $signed({2'b0, step, 8'b0}) - $signed({4'b0, step, 6'b0});
+            ey      <= (30'sd240 <<< 16) - $signed({2'b0, step, 8'b0}) + $signed({6'b0, step, 4'b0});
+        end else if (setup2) begin
+            // recorte da origem entre 0 e o limite (negativo no zoom out)
+            setup2  <= 1'b0;
+            if (ax0 < 0 && ax0 < ex) begin
+                ax0 <= (ex < 0) ? ex : 30'sd0;
+                ax  <= (ex < 0) ? ex : 30'sd0;
+            end else if (ax0 > 0 && ax0 > ex) begin
+                ax0 <= (ex > 0) ? ex : 30'sd0;
+                ax  <= (ex > 0) ? ex : 30'sd0;
+            end else begin
+                ax  <= ax0;
+            end
+            if (ay < 0 && ay < ey) begin
+                ay <= (ey < 0) ? ey : 30'sd0;
+            end else if (ay > 0 && ay > ey) begin
+                ay <= (ey > 0) ? ey : 30'sd0;
+            end
+            nx      <= 9'd0;
+            ny      <= 8'd0;
+            a_valid <= 1'b1;
+        end
+
+        //------------------------------------------------------------
+        // Estágios A e B
+        //------------------------------------------------------------
+        if (a_valid && (!b_active || b_last)) begin
+            // B pega o próximo pixel; A avança
+            b_active <= 1'b1;
+            xl       <= lo_xc;
+            xh       <= hi_xc - 1'b1;
+            yl       <= lo_yc;
+            yh       <= hi_yc - 1'b1;
+            c        <= lo_xc;
+            r        <= lo_yc;
+            b_empty  <= a_empty;
+            b_final  <= a_final;
+            b_area   <= cnt_x * cnt_y;
+            if (a_final) begin
+                a_valid <= 1'b0;
+            end else if (nx == 9'd319) begin
+                nx <= 9'd0;
+                ny <= ny + 1'b1;
+                ax <= ax0;
+                ay <= ay_n;
+            end else begin
+                nx <= nx + 1'b1;
+                ax <= ax_n;
+            end
+        end else if (b_last) begin
+            b_active <= 1'b0;
+        end else if (b_active) begin
+            if (c == xh) begin
+                c <= xl;
+                r <= r + 1'b1;
+            end else begin
+                c <= c + 1'b1;
+            end
+        end
+
+        //------------------------------------------------------------
+        // Espera a leitura da mem1
+        //------------------------------------------------------------
+        valid_p1 <= b_active;
+        first_p1 <= b_empty || (c == xl && r == yl);
+        last_p1  <= b_last;
+        empty_p1 <= b_empty;
+        final_p1 <= b_final;
+        lane_p1  <= src[1:0];
+        area_p1  <= b_area;
+
+        valid_p2 <= valid_p1;
+        first_p2 <= first_p1;
+        last_p2  <= last_p1;
+        empty_p2 <= empty_p1;
+        final_p2 <= final_p1;
+        lane_p2  <= lane_p1;
+        area_p2  <= area_p1;
+
+        //------------------------------------------------------------
+        // Soma da área; no último pixel dela, a média vai para o estágio 4
+        //------------------------------------------------------------
+        if (valid_p2) begin
+            acc <= sum_now;
+        end
+        v_p3     <= valid_p2 && last_p2;
+        sum_p3   <= sum_now;
+        area_p3  <= area_p2;
+        empty_p3 <= empty_p2;
+        final_p3 <= final_p2;
+
+        wr_en <= 1'b0;
+        if (v_p3) begin
+            word_lo <= {avg, word_lo[23:8]};
+            opix    <= opix + 1'b1;
+            if (opix[1:0] == 2'd3) begin
+                wr_en   <= 1'b1;
+                wr_addr <= opix[16:2];
+                wr_data <= {avg, word_lo};
+            end
+            if (final_p3) begin
+                busy <= 1'b0;
+                done <= 1'b1;
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,163 @@
+module zoom_stream(
+    input             clock,
+
+    // Controle (vindo da FSM do main)
+    input             start,        // pulso: gera um quadro inteiro
+    input      [2:0]  zoom,         // nível de destino: 5..7 (2x, 4x, 8x)
+    input      [8:0]  org_x,        // origem da janela de origem (par no 2x)
+    input      [7:0]  org_y,
+    output reg        busy,
+    output reg        done,         // pulso de 1 ciclo: a última escrita sai no ciclo seguinte
+
+    // Porta de leitura da mem1 (palavras de 4 pixels, latência de 2 ciclos)
+    output     [14:0] rd_addr,
+    input      [31:0] rd_data,
+
+    // Porta de escrita do buffer de trás (palavras inteiras)
+    output reg [14:0] wr_addr,
+    output reg [31:0] wr_data,
+    output reg        wr_en
+);
+
+    //================================================================
+    // Zoom in (NHI/PR): saída(x, y) = mem1(cx + (x >> s), cy + (y >> s)),
+    // com a origem (cx, cy) = (org_x, org_y) calculada no main a partir do
+    // centro do zoom, já recortada na imagem. Com fator inteiro a
+    // replicação de pixel dá o mesmo resultado. O zoom out (NH/BA) fica
+    // no zoom_out_stream.v.
+    //
+    // Uma palavra de saída (4 pixels) por ciclo, de uma leitura:
+    // zoom_in_two replica o pixel de origem (no 2x, dois pixels da mesma
+    // palavra: cx é par, então nunca cruzam a palavra). 19200 ciclos por
+    // quadro; no sim_shim, 19207 do ENABLE ao FLAG_DONE em 2x, 4x e 8x
+    // (0,19 ms a 100 MHz).
+    //
+    // Sem multiplicadores: src anda a cada palavra de saída (2 pixels no
+    // 2x, 1 no 4x, 1 a cada duas palavras no 8x) e volta ao início da
+    // linha (row_base) no fim de cada linha; row_base anda 320 a cada
+    // linha de origem.
+    //================================================================
+    reg        running;
+    reg [1:0]  s;            // fator 2^s
+    reg [2:0]  mask;         // 2^s - 1 (linhas de saída por linha de origem)
+
+    reg [6:0]  w;            // palavra de saída na linha
+    reg [7:0]  y;
+    reg        fx;           // 8x: segunda palavra do mesmo pixel de origem
+    reg [2:0]  fy;
+    reg [14:0] out_addr;
+    reg [16:0] src;          // endereço de pixel da origem
+    reg [16:0] row_base;
+
+    assign rd_addr = src[16:2];
+
+    // faixa do pixel de origem; no 2x a palavra de saída usa também o seguinte
+    wire [1:0] lane  = src[1:0];
+    wire [1:0] lane2 = (s == 2'd1) ? lane + 2'd1 : lane;
+
+    // palavras lidas há 1 e 2 ciclos
+    reg        valid_p1, valid_p2;
+    reg        last_p1, last_p2;
+    reg [14:0] out_p1, out_p2;
+    reg [1:0]  lane_p1, lane_p2, lane2_p1, lane2_p2;
+
+    wire [7:0] sample_a = rd_data >> {lane_p2, 3'b000};
+    wire [7:0] sample_b = rd_data >> {lane2_p2, 3'b000};
+
+    wire [31:0] rep_lo, rep_hi;
+
+    zoom_in_two rep0 (
+        .enable(1'b1),
+        .data_in(sample_a),
+        .data_out(rep_lo)
+    );
+
+    zoom_in_two rep1 (
+        .enable(1'b1),
+        .data_in(sample_b),
+        .data_out(rep_hi)
+    );
+
+    initial begin
+        busy    = 1'b0;
+        done    = 1'b0;
+        running = 1'b0;
+        wr_en   = 1'b0;
+    end
+
+    always @(posedge clock) begin
+        done <= 1'b0;
+
+        //------------------------------------------------------------
+        // Estágio 0: gerador de endereços
+        //------------------------------------------------------------
+        if (start && !busy) begin
+            busy     <= 1'b1;
+            running  <= 1'b1;
+            w        <= 7'd0;
+            y        <= 8'd0;
+            fx       <= 1'b0;
+            fy       <= 3'd0;
+            out_addr <= 15'd0;
+            row_base <= {org_y, 8'b0} + {org_y, 6'b0} + org_x;   // org_y * 320 + org_x
+            src      <= {org_y, 8'b0} + {org_y, 6'b0} + org_x;
+            case (zoom)
+                3'b101:  begin s <= 2'd1; mask <= 3'd1; end
+                3'b110:  begin s <= 2'd2; mask <= 3'd3; end
+                default: begin s <= 2'd3; mask <= 3'd7; end
+            endcase
+        end else if (running) begin
+            out_addr <= out_addr + 1'b1;
+            if (w == 7'd79) begin
+                w  <= 7'd0;
+                fx <= 1'b0;
+                y  <= y + 1'b1;
+                fy <= (fy == mask) ? 3'd0 : fy + 1'b1;
+                if (fy == mask) begin
+                    row_base <= row_base + 17'd320;
+                    src      <= row_base + 17'd320;
+                end else begin
+                    src      <= row_base;
+                end
+                if (y == 8'd239) begin
+                    running <= 1'b0;
+                end
+            end else begin
+                w  <= w + 1'b1;
+                fx <= ~fx;
+                case (s)
+                    2'd1:    src <= src + 17'd2;
+                    2'd2:    src <= src + 17'd1;
+                    default: src <= src + fx;
+                endcase
+            end
+        end
+
+        //------------------------------------------------------------
+        // Estágios 1 e 2: espera a leitura da mem1
+        //------------------------------------------------------------
+        valid_p1 <= running;
+        last_p1  <= w == 7'd79 && y == 8'd239;
+        out_p1   <= out_addr;
+        lane_p1  <= lane;
+        lane2_p1 <= lane2;
+
+        valid_p2 <= valid_p1;
+        last_p2  <= last_p1;
+        out_p2   <= out_p1;
+        lane_p2  <= lane_p1;
+        lane2_p2 <= lane2_p1;
+
+        //------------------------------------------------------------
+        // Estágio 3: escrita no buffer de trás
+        //------------------------------------------------------------
+        wr_en   <= valid_p2;
+        wr_addr <= out_p2;
+        wr_data <= {rep_hi[31:16], rep_lo[15:0]};
+        if (valid_p2 && last_p2) begin
+            busy <= 1'b0;
+            done <= 1'b1;
+        end
+    end
+
+endmodule
@@ -13,6 +13,9 @@
 #ifndef LIBCOPROCESSADOR_H_
 #define LIBCOPROCESSADOR_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 /* 
     Garante que o C++ possa linkar com estas funções C/Assembly.
 */
@@ -42,17 +45,51 @@ extern "C" {
 #define STORE_ERR_TIMEOUT   -2  // Hardware não respondeu (timeout)
 #define STORE_ERR_HW        -3  // FPGA reportou um erro (FLAG_ERROR)
 
+/* Fator do API_Zoom_To, em ponto fixo 8.8 (0x0100 = 1x) */
+#define ZOOM_SCALE_ONE  0x0100
+#define ZOOM_SCALE_MIN  0x0020  // 1/8
+#define ZOOM_SCALE_MAX  0x0800  // 8x
+
+/* Níveis do zoom (API_Set_Zoom): 1/8, 1/4, 1/2, 1x, 2x, 4x, 8x */
+#define ZOOM_LEVEL_MIN  1
+#define ZOOM_LEVEL_ONE  4
+#define ZOOM_LEVEL_MAX  7
+
+/* Algoritmos do API_Set_Zoom (zoom in / zoom out) */
+#define ZOOM_ALG_NEAREST   0  // NearestNeighbor / Decimation
+#define ZOOM_ALG_REPLICATE 1  // PixelReplication / BlockAveraging
+#define ZOOM_ALG_BILINEAR  2  // BilinearZoom / Decimation
+
+/* Memórias do FPGA (ASM_Load usa só MEM_ORIGINAL e MEM_WORK) */
+#define MEM_ORIGINAL  0  // mem1: imagem original
+#define MEM_WORK      1  // buffer de trás (mem2..mem5): o quadro exibido antes do último comando
+#define MEM_DISPLAY   2  // buffer da frente (mem2..mem5): o quadro varrido pela VGA
+
 /* ===================================================================
  * Protótipos das Funções Públicas (de api.s)
  * =================================================================== */
 
 /**
- * @brief Abre /dev/mem e mapeia a ponte LW HPS-FPGA.
- * Deve ser chamada primeiro. Requer 'sudo'.
+ * @brief Abre /dev/mem e mapeia a ponte LW HPS-FPGA e a janela VRAM (ponte AXI).
+ * Deve ser chamada primeiro. Requer 'sudo'. Se só a janela VRAM falhar, a
+ * API segue sem ela (API_Get_VRAM devolve NULL).
  * * @return Um ponteiro virtual (sucesso) ou um código de erro (NULL, -1, -2) se falhar.
  */
 extern volatile void* API_initialize(void);
 
+/**
+ * @brief Retorna o ponteiro virtual da janela VRAM na ponte HPS-FPGA AXI.
+ * A janela é mapeada pela API_initialize e aceita escrita direta (ex: memcpy)
+ * de até IMG_SIZE bytes na mem1. Depois de escrever, chame ASM_Refresh para exibir.
+ * Para leitura, a memória X (MEM_ORIGINAL, MEM_WORK, MEM_DISPLAY) começa em
+ * (X << 17) bytes do início da janela. A ponte tem 32 bits: cada palavra
+ * alinhada são 4 pixels (o de menor endereço no byte 0) numa só escrita, e
+ * escritas de byte só alteram o seu pixel.
+ * * @return O ponteiro da janela, ou NULL se a API não foi inicializada ou a
+ * janela não pôde ser mapeada.
+ */
+extern volatile uint8_t* API_Get_VRAM(void);
+
 /**
  * @brief Desmapeia a ponte e fecha o /dev/mem.
  * Deve ser chamada no fim do programa.
@@ -68,12 +105,137 @@ extern void API_close(void);
  */
 extern int ASM_Store(unsigned int address, unsigned char pixel_data);
 
+/**
+ * @brief Envia 4 pixels consecutivos num único pulso de ENABLE (SÍNCRONA/BLOQUEANTE).
+ * Os pixels vão pelo pio_DATA e a instrução STORE leva o modificador EXT_PACKED.
+ * * @param address Endereço do primeiro pixel (0 a 76796).
+ * @param pixels Byte 0 -> address, byte 1 -> address+1, ... byte 3 -> address+3.
+ * @return 0 (Sucesso), -1 (Endereço Inválido), -2 (Timeout), -3 (Erro de Hardware).
+ */
+extern int ASM_Store_Packed(unsigned int address, uint32_t pixels);
+
+/**
+ * @brief Envia um bloco de pixels consecutivos para o FPGA (SÍNCRONA/BLOQUEANTE).
+ * Grupos de 4 pixels vão como STORE empacotado (ver ASM_Store_Packed) e o
+ * resto como STORE simples, num laço apertado: sem o atraso DELAY_COUNT
+ * entre pacotes, apenas a espera pelo FLAG_DONE.
+ * * @param start_addr Endereço inicial na VRAM (0 a 76799).
+ * @param buf Buffer de origem (n bytes, 1 byte por pixel).
+ * @param n Número de pixels; start_addr + n não pode passar de IMG_SIZE.
+ * @return 0 (Sucesso), -1 (Faixa Inválida), -2 (Timeout), -3 (Erro de Hardware).
+ */
+extern int ASM_Store_Block(unsigned int start_addr, const uint8_t *buf, size_t n);
+
+/**
+ * @brief Envia um quadro inteiro para a mem1 pela janela VRAM (SÍNCRONA/BLOQUEANTE).
+ * Cópia em rajadas LDM/STM de 32 bytes, sem protocolo por pixel.
+ * Não atualiza a tela: chame ASM_Refresh em seguida.
+ * * @param buf Quadro de IMG_SIZE bytes, alinhado em 4 bytes (ex: vindo do malloc).
+ * @return 0 (Sucesso), -1 (Janela não mapeada ou buffer desalinhado).
+ */
+extern int ASM_Upload_Frame(const uint8_t *buf);
+
+/**
+ * @brief Lê um pixel de volta do FPGA (função SÍNCRONA/BLOQUEANTE).
+ * O valor vem pela saída DATA_OUT do FPGA (pio_DATA_OUT).
+ * * @param address O endereço do pixel (0 a 76799).
+ * @param sel_mem MEM_ORIGINAL (mem1) ou MEM_WORK (buffer de trás).
+ * @return O pixel (0 a 255), -1 (Endereço Inválido), -2 (Timeout), -3 (Erro de Hardware).
+ */
+extern int ASM_Load(unsigned int address, unsigned int sel_mem);
+
+/**
+ * @brief Copia uma memória inteira do FPGA para o HPS (SÍNCRONA/BLOQUEANTE).
+ * Leitura em rajadas LDM/STM de 32 bytes pela janela VRAM. O FPGA segura a
+ * leitura enquanto a FSM usa a memória; o buffer exibido só é lido fora da área
+ * visível do VGA, então a imagem na tela não é afetada.
+ * * @param which_mem MEM_ORIGINAL, MEM_WORK ou MEM_DISPLAY.
+ * @param buf Destino de IMG_SIZE bytes, alinhado em 4 bytes (ex: vindo do malloc).
+ * @return 0 (Sucesso), -1 (Janela não mapeada, memória inválida ou buffer desalinhado).
+ */
+extern int API_Read_Frame(int which_mem, uint8_t *buf);
+
+/*
+ * ===================================================================
+ * Upload por DMA (o FPGA lê o quadro direto da DDR)
+ *
+ * Os buffers vêm dos 16 MB da DDR em 0x3F000000, que precisam estar
+ * reservados fora do Linux: bootargs mem=1008M, ou um nó reserved-memory
+ * com no-map no device tree. Numa imagem padrão de 1 GB essa região é RAM
+ * do kernel e dos processos; por isso o pool só é mapeado se o
+ * /proc/iomem não mostrar "System RAM" sobre ela (senão API_Dma_Alloc
+ * devolve NULL e o delta.c usa a janela VRAM ou ASM_Store_Block).
+ * ===================================================================
+ */
+
+/**
+ * @brief Reserva um buffer fisicamente contíguo no pool de DMA.
+ * Requer API_initialize (como root: o /proc/iomem só mostra os endereços
+ * para ele). O tamanho é arredondado para 4 KB.
+ * * @param size Tamanho em bytes.
+ * @param phys Recebe o endereço físico do buffer (pode ser NULL).
+ * @return O ponteiro virtual (sem cache), ou NULL se a região não está
+ * reservada (ver acima), o pool acabou ou não pôde ser mapeado.
+ */
+extern void* API_Dma_Alloc(size_t size, uint32_t *phys);
+
+/**
+ * @brief Devolve todos os buffers ao pool de DMA.
+ */
+extern void API_Dma_Free_All(void);
+
+/**
+ * @brief Dispara o DMA de um quadro para a mem1 (ASSÍNCRONA).
+ * Retorna logo após o pulso de ENABLE; o FPGA levanta o FLAG_DONE ao fim.
+ * Não atualiza a tela: chame ASM_Refresh depois do FLAG_DONE.
+ * * @param phys_addr Endereço físico de origem (alinhado em 32 bytes).
+ * @param n Número de bytes (até IMG_SIZE), escritos a partir do endereço 0.
+ * @return 0 (Iniciado), -1 (Tamanho ou alinhamento inválido).
+ */
+extern int ASM_Dma_Upload(uint32_t phys_addr, size_t n);
+
+/* Cabeçalho de um trecho na lista do ASM_Dma_Upload_Spans */
+#define SPAN_MAX_LEN 32767
+#define SPAN_HEADER(addr, len) ((uint32_t)(addr) | ((uint32_t)(len) << 17))
+
+/**
+ * @brief Dispara o DMA de uma lista de trechos para a mem1 (ASSÍNCRONA).
+ * Cada trecho é uma palavra SPAN_HEADER(endereço, pixels) seguida dos
+ * pixels, completados com zeros até múltiplo de 4 bytes. Só os pixels
+ * listados são escritos; o FPGA levanta o FLAG_DONE ao fim.
+ * * @param phys_addr Endereço físico da lista (alinhado em 32 bytes).
+ * @param n Tamanho da lista em bytes (múltiplo de 4, até 0x1FFFF).
+ * @return 0 (Iniciado), -1 (Tamanho ou alinhamento inválido).
+ */
+extern int ASM_Dma_Upload_Spans(uint32_t phys_addr, size_t n);
+
+/**
+ * @brief Dispara o DMA de um quadro comprimido em RLE para a mem1 (ASSÍNCRONA).
+ * O FPGA expande o quadro a partir do endereço 0, um pixel por ciclo.
+ * Formato: byte de controle c < 128 seguido de c + 1 pixels literais, ou
+ * c >= 128 seguido de um pixel que se repete c - 126 vezes (ver rle.h).
+ * * @param phys_addr Endereço físico do quadro comprimido (alinhado em 32 bytes).
+ * @param n Tamanho comprimido em bytes (até 0x1FFFF).
+ * @return 0 (Iniciado), -1 (Tamanho ou alinhamento inválido).
+ */
+extern int ASM_Dma_Upload_Rle(uint32_t phys_addr, size_t n);
+
 /**
  * @brief Envia um comando NOP (Refresh) para o FPGA (assíncrono).
  * (Baseado na sua função 'ASM_Refresh', mas usando o pulso seguro).
  */
 extern void ASM_Refresh(void);
 
+/**
+ * @brief Exibe a mem1 sem tearing: troca de página no próximo vsync (ASSÍNCRONA).
+ * O FPGA copia a mem1 para o buffer de exibição que não está na tela (uma
+ * palavra de 4 pixels por ciclo, ~0,19 ms) e levanta o FLAG_DONE; a troca acontece no
+ * início do próximo vsync. A mem1 já pode receber o próximo quadro logo
+ * após o FLAG_DONE. Se a troca anterior ainda não aconteceu, o comando
+ * espera por ela antes de copiar (no máximo um quadro em espera).
+ */
+extern void ASM_Refresh_Vsync(void);
+
 /**
  * @brief Pulsa o bit ENABLE de forma segura.
  * Esta é a função "disparar" para os algoritmos assíncronos.
@@ -96,6 +258,180 @@ extern void Decimation(void);        // (Opcode 6: Decimação)
 extern void BlockAveraging(void);    // (Opcode 5: Média de Blocos)
 extern void ASM_Reset(void);         // (Opcode 7: Reset)
 
+/**
+ * @brief Zoom in com interpolação bilinear (Opcode 3 + EXT_BILINEAR).
+ * Como NearestNeighbor, sobe um nível e precisa do ASM_Pulse_Enable; no
+ * lado do zoom in (2x, 4x, 8x) cada pixel interpola os 4 vizinhos de
+ * origem com pesos em oitavos, ((8-wx)(8-wy)p00 + wx(8-wy)p01 +
+ * (8-wx)wy p10 + wx wy p11 + 32) >> 6, em vez de replicá-los. Um pixel
+ * por ciclo no FPGA (~0,8 ms). Abaixo de 1x vale a decimação, como no
+ * NearestNeighbor. O emulador gera os mesmos bytes.
+ */
+extern void BilinearZoom(void);
+
+/**
+ * @brief Liga ou desliga o zoom na varredura do VGA (EXT_SCAN).
+ * Ligado, NearestNeighbor, PixelReplication e Decimation não recalculam a
+ * imagem: o VGA lê a cópia em 1x da mem1 que está na tela por um endereço
+ * remapeado, e o novo nível vale a partir do quadro seguinte (o FLAG_DONE
+ * sobe logo). Se a mem1 mudou desde a última cópia, ou se a tela mostra
+ * uma média de blocos, o comando copia a mem1 antes (~0,19 ms). A média de
+ * blocos continua calculada no buffer de exibição.
+ * Com o zoom na varredura, API_Read_Frame(MEM_DISPLAY) devolve a imagem em
+ * 1x, não a vista ampliada.
+ * * @param enable 1 liga; 0 volta ao cálculo do quadro inteiro (padrão).
+ */
+extern void API_Set_Scanout(int enable);
+
+/**
+ * @brief Zoom com fator qualquer, em torno do centro do zoom (ASSÍNCRONA).
+ * O FPGA reamostra a mem1 no fator scale_q8 / 256 direto no buffer de
+ * exibição que não está na tela e troca ao fim: vizinho mais próximo no
+ * zoom in e média da área no zoom out (fora da imagem fica preto). Nas
+ * potências de 2, com o centro no meio da imagem, o resultado é o de
+ * NearestNeighbor e BlockAveraging.
+ * Leva ~0,77 ms no zoom in e até ~1,5 ms no zoom out. Os algoritmos
+ * seguintes partem do nível da potência de 2 logo abaixo do fator
+ * (ex: 1,5x -> nível de 1x).
+ * Espere o FLAG_DONE (ou API_Wait_Done) antes do próximo comando.
+ * * @param scale_q8 Fator em 8.8, de ZOOM_SCALE_MIN (1/8) a ZOOM_SCALE_MAX (8x).
+ * @return 0 (Iniciado), -1 (Fator fora da faixa).
+ */
+extern int API_Zoom_To(unsigned int scale_q8);
+
+/**
+ * @brief Vai direto a um nível do zoom, numa passada só (ASSÍNCRONA).
+ * O FPGA calcula o nível a partir da mem1 no buffer de exibição que não
+ * está na tela e troca ao fim, sem passar pelos níveis do meio: de 1x a
+ * 8x é uma passada (~0,77 ms) em vez de três comandos. O ZOOM_LEVEL_ONE
+ * só copia a mem1 (~0,19 ms). Com API_Set_Scanout(1), NEAREST e
+ * REPLICATE no zoom in (e NEAREST no zoom out) só mudam a varredura.
+ * Os comandos seguintes (NearestNeighbor etc.) partem do novo nível.
+ * Espere o FLAG_DONE (ou API_Wait_Done) antes do próximo comando.
+ * * @param level Nível, de ZOOM_LEVEL_MIN (1/8) a ZOOM_LEVEL_MAX (8x).
+ * @param alg ZOOM_ALG_NEAREST, ZOOM_ALG_REPLICATE ou ZOOM_ALG_BILINEAR.
+ * @return 0 (Iniciado), -1 (Nível ou algoritmo inválido).
+ */
+extern int API_Set_Zoom(unsigned int level, unsigned int alg);
+
+/**
+ * @brief Liga ou desliga o cache de níveis do zoom (começa vazio).
+ * O FPGA tem 2 buffers de exibição, ou 4 se sintetizado com a macro
+ * ZOOM_CACHE_4BUF (ver main.v): com 2, o cache só guarda o quadro anterior
+ * ao exibido, o que já cobre ir e voltar entre dois níveis. Ligado, cada
+ * quadro calculado fica guardado com a chave (nível, algoritmo, centro e fator do
+ * API_Zoom_To); pedir de novo um quadro guardado só troca a frente para
+ * ele, sem recalcular (FLAG_DONE em poucos ciclos). Um quadro novo vai
+ * para um buffer livre, senão para o exibido há mais tempo. NearestNeighbor
+ * e PixelReplication dão o mesmo zoom in e dividem a entrada.
+ * Qualquer escrita na mem1 (ASM_Store, upload, DMA, janela VRAM) e o
+ * ASM_Reset esvaziam o cache. Com ele ligado, MEM_WORK é o buffer que vai
+ * receber o próximo quadro, não necessariamente o exibido antes.
+ * * @param enable 1 liga; 0 desliga (padrão).
+ */
+extern void API_Set_Zoom_Cache(int enable);
+
+/**
+ * @brief Acertos e falhas do cache de níveis desde a configuração do FPGA.
+ * Os mesmos valores de PerfCounters.zoom_cache_hits/misses; só contam
+ * com o cache ligado.
+ * @return 0 (Sucesso), -1 (API não inicializada ou FPGA sem os contadores).
+ */
+extern int API_Get_Zoom_Cache_Stats(uint32_t *hits, uint32_t *misses);
+
+/**
+ * @brief Define o ponto da mem1 em torno do qual os zooms são feitos.
+ * Vale para os algoritmos seguintes (e, com o zoom na varredura, já no
+ * próximo quadro); a imagem na tela não é recalculada. No zoom in a
+ * janela de origem fica centrada em (x, y), mas é recortada para não sair
+ * da imagem (perto da borda o ponto deixa de ficar no meio da tela); no
+ * 2x a janela começa numa coluna par. No zoom out o ponto vai para o meio
+ * da tela, com a imagem reduzida posicionada de 4 em 4 pixels em x.
+ * O ASM_Reset volta o centro para (160, 120). Síncrona: nada para esperar.
+ * * @param x Coluna (0 a IMG_WIDTH - 1).
+ * @param y Linha (0 a IMG_HEIGHT - 1).
+ * @return 0 (Sucesso), -1 (Ponto fora da imagem).
+ */
+extern int API_Set_Zoom_Center(unsigned int x, unsigned int y);
+
+/*
+ * ===================================================================
+ * Conclusão por Interrupção
+ *
+ * FLAG_DONE e FLAG_ERROR geram a IRQ f2h_irq0[0] (pio_FLAGS com
+ * captura de borda). O kernel precisa de um nó generic-uio para o
+ * pio_FLAGS (reg = <0xff200020 0x10>, interrupts = <0 40 4>) e de
+ * uio_pdrv_genirq.of_id=generic-uio nos bootargs; ele aparece como
+ * /dev/uio0.
+ * ===================================================================
+ */
+
+/**
+ * @brief Abre /dev/uio0 (na primeira chamada) e habilita a IRQ de DONE/ERROR.
+ * O descritor pode ser usado em poll/select/epoll (POLLIN) junto de
+ * outros eventos; após cada leitura chame API_Irq_Rearm().
+ * @return O descritor de arquivo, ou -1 se não houver dispositivo UIO.
+ */
+extern int API_Get_Irq_Fd(void);
+
+/**
+ * @brief Limpa as bordas capturadas no pio_FLAGS e reabilita a IRQ no UIO.
+ * @return 0 em sucesso, -1 se não houver dispositivo UIO.
+ */
+extern int API_Irq_Rearm(void);
+
+/**
+ * @brief Bloqueia (sem polling) até FLAG_DONE. O FLAG_ERROR só é lido com o
+ * comando terminado (ele fica em 1 até o ASM_Reset).
+ * @param timeout_us Tempo máximo de cada espera, em microssegundos.
+ * @return 0 concluído, -1 sem dispositivo UIO (use polling),
+ *         -2 timeout, -3 concluído com FLAG_ERROR.
+ */
+extern int API_Wait_Done(unsigned int timeout_us);
+
+/*
+ * ===================================================================
+ * Contadores de Desempenho (perf_counters.v)
+ *
+ * Contam ciclos de clk_100 (100 MHz) desde a configuração do FPGA;
+ * o ASM_Reset não os zera. Para medir um trecho, leia antes e depois
+ * e subtraia.
+ * ===================================================================
+ */
+
+/* Estados da FSM do main.v (índice de state_cycles) */
+#define PERF_ST_IDLE            0
+#define PERF_ST_READ_AND_WRITE  1
+#define PERF_ST_ALGORITHM       2
+#define PERF_ST_RESET           3
+#define PERF_ST_COPY_READ       4
+#define PERF_ST_STREAM          5  // os quatro algoritmos (zoom_stream.v, zoom_out_stream.v)
+#define PERF_ST_DMA_WAIT        6
+#define PERF_ST_WAIT_WR_OR_RD   7
+#define PERF_NUM_STATES         8
+
+#define PERF_CLOCK_HZ 100000000
+
+typedef struct {
+    uint64_t timestamp;                     // ciclos desde a configuração
+    uint64_t state_cycles[PERF_NUM_STATES]; // ciclos em cada estado (PERF_ST_*)
+    uint32_t ops_done;                      // comandos concluídos
+    uint32_t last_op_cycles;                // ciclos do último comando (ENABLE até o IDLE)
+    uint32_t vsyncs;                        // quadros varridos pelo VGA (~60 por segundo)
+    uint32_t flips;                         // trocas de buffer (quadros novos na tela)
+    uint32_t zoom_cache_hits;               // níveis achados no cache (API_Set_Zoom_Cache)
+    uint32_t zoom_cache_misses;             // níveis calculados com o cache ligado
+} PerfCounters;
+
+/**
+ * @brief Lê todos os contadores de desempenho de uma vez (cópia coerente).
+ * Pelos PIOs PERF_SEL/PERF: o FPGA congela uma cópia dos contadores e
+ * ela é lida palavra por palavra.
+ * * @param out Destino dos contadores.
+ * @return 0 (Sucesso), -1 (API não inicializada ou FPGA sem os contadores).
+ */
+extern int API_Read_Perf_Counters(PerfCounters *out);
+
 /*
  * ===================================================================
  * Funções de Leitura de Flag (para Polling)
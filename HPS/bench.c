@@ -0,0 +1,507 @@
+/*
+ * =========================================================================
+ * bench.c: Medição de Latência do Coprocessador
+ * =========================================================================
+ *
+ * Mede, com CLOCK_MONOTONIC, o tempo de cada operação da api.h e imprime
+ * os percentis (p50/p99/max) em CSV ou JSON. Não depende do backend: é
+ * ligado ao lib.s (make bench), ao emulador (make bench_emu) ou à
+ * co-simulação, como qualquer outro programa da api.h.
+ *
+ * Operações medidas:
+ *  - store              ASM_Store de um pixel
+ *  - upload_vram        quadro inteiro pela janela VRAM (ASM_Upload_Frame)
+ *  - upload_store_block quadro inteiro pelo protocolo de STORE
+ *  - upload_dma         quadro inteiro pelo DMA (se houver pool)
+ *  - upload_delta       delta_upload com um retângulo de 32x24 mudando
+ *  - rle_encode         compressão RLE do quadro (só CPU)
+ *  - upload_rle         compressão + DMA do quadro comprimido (se houver pool)
+ *  - <alg>_z<N>         cada algoritmo partindo do nível de zoom N (1..7)
+ *  - reset_copy         ASM_Reset + cópia mem1 -> buffer de trás até o FLAG_DONE
+ *  - bmp_decode         load_bmp
+ *
+ * Se o FPGA tiver os contadores de desempenho, a divisão dos ciclos por
+ * estado da FSM durante o bench sai em stderr.
+ *
+ * Uso: ./bench [-n amostras] [-f csv|json] [-o arquivo] [imagem.bmp]
+ *
+ */
+
+#define _DEFAULT_SOURCE
+#include "api.h"
+#include "image_io.h"
+#include "delta.h"
+#include "rle.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#ifndef BENCH_BACKEND
+#define BENCH_BACKEND "desconhecido"
+#endif
+
+#define DEFAULT_SAMPLES 50
+#define STORE_SAMPLES_MULT 20       // o ASM_Store é barato: mais amostras
+#define WAIT_TIMEOUT_US 5000000
+#define ZOOM_DEFAULT 4              // nível 1x (current_zoom do main.v)
+#define ZOOM_MIN 1
+#define ZOOM_MAX 7
+
+// Resultado de uma operação (tempos em microssegundos)
+typedef struct {
+    char name[32];
+    int n;
+    int failures;
+    double min, p50, p99, max, mean;
+} BenchResult;
+
+static BenchResult results[64];
+static int n_results;
+
+static double now_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Percentil pelo método do posto mais próximo (amostras já ordenadas)
+static double percentile(const double *sorted, int n, double p) {
+    int rank = (int)(p / 100.0 * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+static void add_result(const char *name, double *samples, int n, int failures) {
+    if (n_results >= (int)(sizeof(results) / sizeof(results[0]))) {
+        return;
+    }
+    BenchResult *r = &results[n_results++];
+    memset(r, 0, sizeof(*r));
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->n = n;
+    r->failures = failures;
+    if (n == 0) {
+        return;
+    }
+
+    qsort(samples, n, sizeof(double), cmp_double);
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += samples[i];
+    }
+    r->min = samples[0];
+    r->p50 = percentile(samples, n, 50);
+    r->p99 = percentile(samples, n, 99);
+    r->max = samples[n - 1];
+    r->mean = sum / n;
+}
+
+// Espera o FLAG_DONE: interrupção se houver, senão polling sem sleep
+// (o sleep de 100 ms do main.c mascararia a latência real)
+static int wait_done(void) {
+    int status = API_Wait_Done(WAIT_TIMEOUT_US);
+    if (status == -1) {
+        double limit = now_us() + WAIT_TIMEOUT_US;
+        while (!ASM_Get_Flag_Done()) {
+            if (now_us() > limit) {
+                return -2;
+            }
+        }
+        status = ASM_Get_Flag_Error() ? -3 : 0;
+    }
+    return status;
+}
+
+static int run_op(void (*set_op)(void)) {
+    set_op();
+    ASM_Pulse_Enable();
+    return wait_done();
+}
+
+// ASM_Reset já pulsa o ENABLE; volta ao zoom 1x e copia a mem1 para a tela
+static int reset_and_wait(void) {
+    ASM_Reset();
+    return wait_done();
+}
+
+// A partir do reset, leva o zoom ao nível pedido (NHI sobe, NH desce)
+static int goto_level(int level) {
+    if (reset_and_wait() != 0) {
+        return -1;
+    }
+    for (int z = ZOOM_DEFAULT; z < level; z++) {
+        if (run_op(NearestNeighbor) != 0) return -1;
+    }
+    for (int z = ZOOM_DEFAULT; z > level; z--) {
+        if (run_op(Decimation) != 0) return -1;
+    }
+    return 0;
+}
+
+/* ===================================================================
+ * Operações medidas
+ * =================================================================== */
+
+static void bench_store(int n) {
+    double *s = malloc(n * sizeof(double));
+    int ok = 0, fail = 0;
+    for (int i = 0; i < n; i++) {
+        unsigned int addr = (unsigned int)(i * 7919) % IMG_SIZE;
+        double t0 = now_us();
+        int status = ASM_Store(addr, (unsigned char)i);
+        double t1 = now_us();
+        if (status == STORE_SUCCESS) s[ok++] = t1 - t0;
+        else fail++;
+    }
+    add_result("store", s, ok, fail);
+    free(s);
+}
+
+static void bench_upload(const uint8_t *image, int n) {
+    double *s = malloc(n * sizeof(double));
+    int ok, fail;
+
+    // Janela VRAM (o backend pode não ter: todas falham e a linha sai com n=0)
+    ok = fail = 0;
+    for (int i = 0; i < n; i++) {
+        double t0 = now_us();
+        int status = ASM_Upload_Frame(image);
+        double t1 = now_us();
+        if (status == 0) s[ok++] = t1 - t0;
+        else fail++;
+    }
+    add_result("upload_vram", s, ok, fail);
+
+    ok = fail = 0;
+    for (int i = 0; i < n; i++) {
+        double t0 = now_us();
+        int status = ASM_Store_Block(0, image, IMG_SIZE);
+        double t1 = now_us();
+        if (status == STORE_SUCCESS) s[ok++] = t1 - t0;
+        else fail++;
+    }
+    add_result("upload_store_block", s, ok, fail);
+
+    // DMA: a cópia para o buffer entra na conta, como faria a aplicação
+    uint32_t phys;
+    uint8_t *dma_buf = API_Dma_Alloc(IMG_SIZE, &phys);
+    ok = fail = 0;
+    if (dma_buf) {
+        for (int i = 0; i < n; i++) {
+            double t0 = now_us();
+            memcpy(dma_buf, image, IMG_SIZE);
+            int status = ASM_Dma_Upload(phys, IMG_SIZE);
+            if (status == 0) status = wait_done();
+            double t1 = now_us();
+            if (status == 0) s[ok++] = t1 - t0;
+            else fail++;
+        }
+        API_Dma_Free_All();
+    }
+    add_result("upload_dma", s, ok, fail);
+    free(s);
+}
+
+// Conteúdo que muda aos poucos: um retângulo de 32x24 anda pela imagem
+static void bench_delta(const uint8_t *image, int n) {
+    double *s = malloc(n * sizeof(double));
+    uint8_t *frame = malloc(IMG_SIZE);
+    uint64_t bus = 0;
+    int ok = 0, fail = 0;
+
+    memcpy(frame, image, IMG_SIZE);
+    delta_upload(frame, NULL); // primeiro envio: quadro inteiro
+    for (int i = 0; i < n; i++) {
+        int x0 = (i * 37) % (IMG_WIDTH - 32), y0 = (i * 23) % (IMG_HEIGHT - 24);
+        for (int y = y0; y < y0 + 24; y++) {
+            for (int x = x0; x < x0 + 32; x++) {
+                frame[y * IMG_WIDTH + x] ^= 0xFF;
+            }
+        }
+        DeltaStats st;
+        double t0 = now_us();
+        int status = delta_upload(frame, &st);
+        double t1 = now_us();
+        if (status == 0) {
+            s[ok++] = t1 - t0;
+            bus += st.bus_bytes;
+        } else {
+            fail++;
+        }
+    }
+    add_result("upload_delta", s, ok, fail);
+    if (ok) {
+        fprintf(stderr, "upload_delta: %.0f bytes pela ponte por quadro (%.1fx menos que o quadro inteiro)\n",
+                (double)bus / ok, (double)IMG_SIZE * ok / (bus ? bus : 1));
+    }
+    delta_close();
+    API_Dma_Free_All();
+    free(frame);
+    free(s);
+}
+
+static void bench_rle(const uint8_t *image, int n) {
+    double *s = malloc(n * sizeof(double));
+    uint8_t *enc = malloc(RLE_MAX_ENCODED(IMG_SIZE));
+    uint8_t *check = malloc(IMG_SIZE);
+    size_t enc_size = 0;
+    int ok = 0, fail = 0;
+
+    for (int i = 0; i < n; i++) {
+        double t0 = now_us();
+        enc_size = rle_encode(image, IMG_SIZE, enc);
+        double t1 = now_us();
+        s[ok++] = t1 - t0;
+    }
+    add_result("rle_encode", s, ok, 0);
+
+    // confere o formato antes de mandar para o FPGA
+    if (rle_decode(enc, enc_size, check, IMG_SIZE) != IMG_SIZE || memcmp(check, image, IMG_SIZE) != 0) {
+        fprintf(stderr, "Erro: RLE não reproduz o quadro\n");
+        add_result("upload_rle", s, 0, n);
+        goto out;
+    }
+
+    uint32_t phys;
+    uint8_t *dma_buf = API_Dma_Alloc(RLE_MAX_ENCODED(IMG_SIZE), &phys);
+    ok = fail = 0;
+    if (dma_buf) {
+        for (int i = 0; i < n; i++) {
+            double t0 = now_us();
+            size_t len = rle_encode(image, IMG_SIZE, enc);
+            memcpy(dma_buf, enc, len);
+            int status = ASM_Dma_Upload_Rle(phys, len);
+            if (status == 0) status = wait_done();
+            double t1 = now_us();
+            if (status == 0) s[ok++] = t1 - t0;
+            else fail++;
+        }
+        API_Dma_Free_All();
+    }
+    add_result("upload_rle", s, ok, fail);
+    fprintf(stderr, "RLE: %zu de %d bytes (%.2fx)\n", enc_size, IMG_SIZE, (double)IMG_SIZE / enc_size);
+    if (ok) {
+        const BenchResult *r = &results[n_results - 1];
+        fprintf(stderr, "upload_rle: %.1f MB/s de pixels (p50)\n", IMG_SIZE / r->p50);
+    }
+
+out:
+    free(check);
+    free(enc);
+    free(s);
+}
+
+static void bench_algorithms(int n) {
+    static const struct {
+        const char *name;
+        void (*set_op)(void);
+        int zoom_in;
+    } algs[] = {
+        {"nearest_neighbor", NearestNeighbor, 1},
+        {"pixel_replication", PixelReplication, 1},
+        {"decimation", Decimation, 0},
+        {"block_averaging", BlockAveraging, 0},
+    };
+    double *s = malloc(n * sizeof(double));
+
+    for (size_t a = 0; a < sizeof(algs) / sizeof(algs[0]); a++) {
+        for (int level = ZOOM_MIN; level <= ZOOM_MAX; level++) {
+            // no limite o comando não faz nada (só sinaliza MAX/MIN_ZOOM)
+            if ((algs[a].zoom_in && level == ZOOM_MAX) || (!algs[a].zoom_in && level == ZOOM_MIN)) {
+                continue;
+            }
+            int ok = 0, fail = 0;
+            for (int i = 0; i < n; i++) {
+                if (goto_level(level) != 0) {
+                    fail++;
+                    continue;
+                }
+                double t0 = now_us();
+                int status = run_op(algs[a].set_op);
+                double t1 = now_us();
+                if (status == 0) s[ok++] = t1 - t0;
+                else fail++;
+            }
+            char name[32];
+            snprintf(name, sizeof(name), "%s_z%d", algs[a].name, level);
+            add_result(name, s, ok, fail);
+        }
+    }
+    free(s);
+}
+
+static void bench_reset(int n) {
+    double *s = malloc(n * sizeof(double));
+    int ok = 0, fail = 0;
+    for (int i = 0; i < n; i++) {
+        // sai do 1x para que a cópia não seja trivial para nenhum backend
+        if (run_op(NearestNeighbor) != 0) {
+            fail++;
+            continue;
+        }
+        double t0 = now_us();
+        int status = reset_and_wait();
+        double t1 = now_us();
+        if (status == 0) s[ok++] = t1 - t0;
+        else fail++;
+    }
+    add_result("reset_copy", s, ok, fail);
+    free(s);
+}
+
+static void bench_bmp(const char *filename, uint8_t *image, int n) {
+    double *s = malloc(n * sizeof(double));
+    int ok = 0, fail = 0;
+    for (int i = 0; i < n; i++) {
+        double t0 = now_us();
+        int status = load_bmp(filename, image);
+        double t1 = now_us();
+        if (status == 0) s[ok++] = t1 - t0;
+        else fail++;
+    }
+    add_result("bmp_decode", s, ok, fail);
+    free(s);
+}
+
+/* ===================================================================
+ * Saída
+ * =================================================================== */
+
+// Onde foram os ciclos do FPGA durante o bench (contadores de hardware)
+static void print_perf(const PerfCounters *p0, const PerfCounters *p1) {
+    static const char *const names[PERF_NUM_STATES] = {
+        "IDLE", "READ_AND_WRITE", "ALGORITHM", "RESET",
+        "COPY_READ", "STREAM", "DMA_WAIT", "WAIT_WR_OR_RD"
+    };
+    uint64_t total = p1->timestamp - p0->timestamp;
+    if (total == 0) {
+        return;
+    }
+    fprintf(stderr, "Ciclos do FPGA: %llu (%.3f ms), %u comandos\n", (unsigned long long)total,
+            total * 1e3 / PERF_CLOCK_HZ, p1->ops_done - p0->ops_done);
+    for (int i = 0; i < PERF_NUM_STATES; i++) {
+        uint64_t c = p1->state_cycles[i] - p0->state_cycles[i];
+        fprintf(stderr, "  %-15s %14llu  %5.1f%%\n", names[i], (unsigned long long)c, 100.0 * c / total);
+    }
+}
+
+static void print_csv(FILE *out) {
+    fprintf(out, "backend,op,n,failures,min_us,p50_us,p99_us,max_us,mean_us\n");
+    for (int i = 0; i < n_results; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "%s,%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f\n", BENCH_BACKEND, r->name, r->n,
+                r->failures, r->min, r->p50, r->p99, r->max, r->mean);
+    }
+}
+
+static void print_json(FILE *out) {
+    fprintf(out, "{\n  \"backend\": \"%s\",\n  \"unit\": \"us\",\n  \"results\": [\n", BENCH_BACKEND);
+    for (int i = 0; i < n_results; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out,
+                "    {\"op\": \"%s\", \"n\": %d, \"failures\": %d, \"min\": %.3f, \"p50\": %.3f, "
+                "\"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f}%s\n",
+                r->name, r->n, r->failures, r->min, r->p50, r->p99, r->max, r->mean,
+                i + 1 < n_results ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Uso: %s [-n amostras] [-f csv|json] [-o arquivo] [imagem.bmp]\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    int samples = DEFAULT_SAMPLES;
+    int json = 0;
+    const char *out_name = NULL;
+    const char *bmp_name = "img.bmp";
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:f:o:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                samples = atoi(optarg);
+                break;
+            case 'f':
+                if (strcmp(optarg, "json") == 0) json = 1;
+                else if (strcmp(optarg, "csv") == 0) json = 0;
+                else { usage(argv[0]); return 1; }
+                break;
+            case 'o':
+                out_name = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (optind < argc) {
+        bmp_name = argv[optind];
+    }
+    if (samples < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint8_t *image = malloc(IMG_SIZE);
+    if (load_bmp(bmp_name, image) != 0) {
+        // sem imagem, mede com um padrão sintético (bmp_decode fica de fora)
+        fprintf(stderr, "Aviso: usando padrão sintético no lugar de '%s'\n", bmp_name);
+        for (int i = 0; i < IMG_SIZE; i++) {
+            image[i] = (uint8_t)((i % IMG_WIDTH) ^ (i / IMG_WIDTH));
+        }
+        bmp_name = NULL;
+    }
+
+    volatile void *base = API_initialize();
+    if (base == NULL || base == (void *)INIT_ERR_OPEN || base == (void *)INIT_ERR_MMAP) {
+        fprintf(stderr, "Erro: API_initialize falhou\n");
+        free(image);
+        return 1;
+    }
+
+    fprintf(stderr, "Backend %s, %d amostras por operação...\n", BENCH_BACKEND, samples);
+    PerfCounters perf0, perf1;
+    int have_perf = (API_Read_Perf_Counters(&perf0) == 0);
+    bench_store(samples * STORE_SAMPLES_MULT);
+    bench_upload(image, samples);
+    bench_delta(image, samples);
+    bench_rle(image, samples);
+    // algoritmos e reset trabalham sobre a imagem real
+    if (ASM_Upload_Frame(image) != 0) {
+        ASM_Store_Block(0, image, IMG_SIZE);
+    }
+    bench_algorithms(samples);
+    bench_reset(samples);
+    if (bmp_name) {
+        bench_bmp(bmp_name, image, samples);
+    }
+
+    if (have_perf && API_Read_Perf_Counters(&perf1) == 0) {
+        print_perf(&perf0, &perf1);
+    }
+    API_close();
+
+    FILE *out = stdout;
+    if (out_name && !(out = fopen(out_name, "w"))) {
+        fprintf(stderr, "Erro ao criar '%s'\n", out_name);
+        free(image);
+        return 1;
+    }
+    if (json) print_json(out);
+    else print_csv(out);
+    if (out != stdout) fclose(out);
+
+    free(image);
+    return 0;
+}
@@ -0,0 +1,248 @@
+#define _DEFAULT_SOURCE
+#include "delta.h"
+#include "api.h"
+#include "rle.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+// Trechos separados por até DELTA_MERGE_GAP pixels iguais viram um só:
+// um trecho novo custa o cabeçalho (4 bytes) e até 3 bytes de enchimento
+#define DELTA_MERGE_GAP 8
+#define DELTA_MAX_SPANS (IMG_SIZE / (DELTA_MERGE_GAP + 2) + 1)
+#define DELTA_LIST_MAX  IMG_SIZE   // acima disso o quadro inteiro sai mais barato
+#define DELTA_TIMEOUT_US 5000000
+
+typedef struct {
+    uint32_t addr;
+    uint32_t len;
+} DeltaSpan;
+
+static uint8_t  *shadow;          // último quadro enviado
+static int       shadow_valid;
+static DeltaSpan spans[DELTA_MAX_SPANS];
+static uint8_t  *dma_list;        // lista de trechos no pool de DMA (NULL = sem DMA)
+static uint32_t  dma_list_phys;
+static int       dma_checked;
+static uint8_t   rle_buf[RLE_MAX_ENCODED(IMG_SIZE)];
+
+/* ===================================================================
+ * Comparação com a sombra
+ * =================================================================== */
+
+// Primeiro índice >= i em que a e b diferem (n se não houver)
+static size_t find_diff(const uint8_t *a, const uint8_t *b, size_t i, size_t n) {
+#ifdef __ARM_NEON
+    // 32 bytes por iteração: XOR das duas metades e redução para 32 bits
+    for (; i + 32 <= n; i += 32) {
+        uint8x16_t x = vorrq_u8(veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i)),
+                                veorq_u8(vld1q_u8(a + i + 16), vld1q_u8(b + i + 16)));
+        uint32x4_t w = vreinterpretq_u32_u8(x);
+        uint32x2_t r = vorr_u32(vget_low_u32(w), vget_high_u32(w));
+        if (vget_lane_u32(vpmax_u32(r, r), 0) != 0) {
+            break;
+        }
+    }
+#else
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        if (x != y) {
+            break;
+        }
+    }
+#endif
+    while (i < n && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+// Monta a lista de trechos que mudaram; retorna o número de trechos
+static uint32_t build_spans(const uint8_t *frame, uint32_t *dirty) {
+    uint32_t count = 0;
+    size_t n = IMG_SIZE;
+    size_t i = find_diff(frame, shadow, 0, n);
+
+    *dirty = 0;
+    while (i < n) {
+        size_t start = i, end = i + 1;
+        for (;;) {
+            while (end < n && end - start < SPAN_MAX_LEN && frame[end] != shadow[end]) {
+                end++;
+            }
+            i = find_diff(frame, shadow, end, n);
+            if (i >= n || i - end > DELTA_MERGE_GAP || i + 1 - start > SPAN_MAX_LEN) {
+                break;
+            }
+            end = i + 1;
+        }
+        spans[count].addr = (uint32_t)start;
+        spans[count].len = (uint32_t)(end - start);
+        count++;
+    }
+
+    // pixels realmente diferentes (os trechos incluem as lacunas unidas)
+    for (uint32_t s = 0; s < count; s++) {
+        for (uint32_t k = 0; k < spans[s].len; k++) {
+            *dirty += frame[spans[s].addr + k] != shadow[spans[s].addr + k];
+        }
+    }
+    return count;
+}
+
+/* ===================================================================
+ * Envio
+ * =================================================================== */
+
+// Espera o FLAG_DONE do DMA (interrupção ou polling)
+static int wait_dma(void) {
+    int status = API_Wait_Done(DELTA_TIMEOUT_US);
+    if (status == -1) {
+        struct timespec t0, t;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        while (!ASM_Get_Flag_Done()) {
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            if ((t.tv_sec - t0.tv_sec) * 1000000L + (t.tv_nsec - t0.tv_nsec) / 1000 > DELTA_TIMEOUT_US) {
+                return -2;
+            }
+        }
+        status = ASM_Get_Flag_Error() ? -3 : 0;
+    }
+    return status;
+}
+
+// Quadro inteiro: comprimido pelo DMA se couber em menos bytes;
+// senão janela VRAM, DMA simples ou STOREs. bus recebe os bytes na ponte.
+static int upload_full(const uint8_t *frame, uint32_t *bus) {
+    *bus = IMG_SIZE;
+    if (dma_list) {
+        size_t enc = rle_encode(frame, IMG_SIZE, rle_buf);
+        if (enc < IMG_SIZE) {
+            memcpy(dma_list, rle_buf, enc);
+            if (ASM_Dma_Upload_Rle(dma_list_phys, enc) != 0) {
+                return -3;
+            }
+            *bus = (uint32_t)enc;
+            return wait_dma();
+        }
+    }
+    if (ASM_Upload_Frame(frame) == 0) {
+        return 0;
+    }
+    if (dma_list) {
+        memcpy(dma_list, frame, IMG_SIZE);
+        if (ASM_Dma_Upload(dma_list_phys, IMG_SIZE) != 0) {
+            return -3;
+        }
+        return wait_dma();
+    }
+    return ASM_Store_Block(0, frame, IMG_SIZE) == STORE_SUCCESS ? 0 : -3;
+}
+
+static int upload_spans(const uint8_t *frame, uint32_t count) {
+    if (dma_list) {
+        // cabeçalho + pixels, completados até a próxima palavra
+        uint32_t pos = 0;
+        for (uint32_t s = 0; s < count; s++) {
+            uint32_t head = SPAN_HEADER(spans[s].addr, spans[s].len);
+            uint32_t padded = (spans[s].len + 3) & ~3u;
+            memcpy(dma_list + pos, &head, 4);
+            memcpy(dma_list + pos + 4, frame + spans[s].addr, spans[s].len);
+            memset(dma_list + pos + 4 + spans[s].len, 0, padded - spans[s].len);
+            pos += 4 + padded;
+        }
+        if (ASM_Dma_Upload_Spans(dma_list_phys, pos) != 0) {
+            return -3;
+        }
+        return wait_dma();
+    }
+
+    // Janela VRAM: palavras alinhadas que cobrem o trecho (4 pixels por
+    // escrita). Os pixels de sobra na primeira e na última palavra vêm do
+    // próprio quadro, então também estão certos
+    volatile uint32_t *vram = (volatile uint32_t *)API_Get_VRAM();
+    uint32_t last = 0;
+    for (uint32_t s = 0; s < count; s++) {
+        if (vram) {
+            uint32_t w = spans[s].addr / 4, end = (spans[s].addr + spans[s].len + 3) / 4;
+            for (; w < end; w++) {
+                uint32_t px;
+                memcpy(&px, frame + w * 4, 4); // pixel de menor endereço no byte 0
+                vram[w] = px;
+            }
+            last = end - 1;
+        } else if (ASM_Store_Block(spans[s].addr, frame + spans[s].addr, spans[s].len) != STORE_SUCCESS) {
+            return -3;
+        }
+    }
+    if (vram && count) {
+        // a leitura de volta esvazia as escritas pendentes na ponte AXI (como
+        // no ASM_Upload_Frame): o ASM_Refresh vem pela ponte LW e não pode
+        // começar a cópia antes delas chegarem na mem1
+        (void)vram[last];
+        __sync_synchronize();
+    }
+    return 0;
+}
+
+int delta_upload(const uint8_t *frame, DeltaStats *stats) {
+    DeltaStats st = {0, IMG_SIZE, IMG_SIZE, 1};
+    uint32_t count = 0;
+    int status;
+
+    if (!shadow && !(shadow = malloc(IMG_SIZE))) {
+        return -3;
+    }
+    if (!dma_checked) {
+        dma_list = API_Dma_Alloc(DELTA_LIST_MAX, &dma_list_phys);
+        dma_checked = 1;
+    }
+
+    if (shadow_valid) {
+        count = build_spans(frame, &st.dirty_pixels);
+        uint32_t list = 0, pixels = 0, words = 0;
+        for (uint32_t s = 0; s < count; s++) {
+            list += 4 + ((spans[s].len + 3) & ~3u);
+            pixels += spans[s].len;
+            words += (spans[s].addr + spans[s].len + 3) / 4 - spans[s].addr / 4;
+        }
+        st.full = list > DELTA_LIST_MAX;
+        st.spans = st.full ? 0 : count;
+        st.bus_bytes = st.full ? IMG_SIZE : dma_list ? list : API_Get_VRAM() ? 4 * words : pixels;
+    }
+
+    if (st.full) {
+        status = upload_full(frame, &st.bus_bytes);
+    } else {
+        status = count ? upload_spans(frame, count) : 0;
+    }
+
+    if (status == 0) {
+        memcpy(shadow, frame, IMG_SIZE);
+        shadow_valid = 1;
+    } else {
+        shadow_valid = 0; // mem1 em estado desconhecido
+    }
+    if (stats) {
+        *stats = st;
+    }
+    return status;
+}
+
+void delta_invalidate(void) {
+    shadow_valid = 0;
+}
+
+void delta_close(void) {
+    free(shadow);
+    shadow = NULL;
+    shadow_valid = 0;
+    dma_list = NULL; // o buffer volta ao pool com API_Dma_Free_All
+    dma_checked = 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * =========================================================================
+ * delta.h: Envio Incremental de Quadros (só o que mudou)
+ * =========================================================================
+ *
+ * Guarda uma cópia (sombra) do último quadro enviado para a mem1 e, a
+ * cada novo quadro, envia apenas os trechos que mudaram. Os trechos vão
+ * numa única lista pelo DMA (ASM_Dma_Upload_Spans): cada um custa um
+ * cabeçalho de 4 bytes mais os pixels. Sem pool de DMA (região não
+ * reservada no kernel, ver api.h), os trechos são escritos pela janela
+ * VRAM, em palavras alinhadas de 4 pixels, ou, em último caso, com
+ * ASM_Store_Block.
+ *
+ * O primeiro envio (e qualquer quadro em que a lista ficaria maior que
+ * o próprio quadro) vai inteiro, comprimido em RLE (rle.h) quando há
+ * DMA e a compressão compensa.
+ *
+ * #include "delta.h"
+ *
+ */
+
+#ifndef DELTA_H_
+#define DELTA_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t spans;        // trechos enviados (0 se o quadro não mudou)
+    uint32_t dirty_pixels; // pixels diferentes do último quadro enviado
+    uint32_t bus_bytes;    // bytes que cruzaram a ponte (cabeçalhos + pixels)
+    int      full;         // 1 se o quadro foi enviado inteiro (talvez comprimido)
+} DeltaStats;
+
+/**
+ * @brief Envia para a mem1 só o que mudou desde o último delta_upload.
+ * Requer API_initialize. O buffer de DMA é reservado no primeiro uso:
+ * não chame API_Dma_Free_All sem chamar delta_close antes.
+ * Não atualiza a tela: chame ASM_Refresh depois.
+ * @param frame Quadro de IMG_SIZE bytes.
+ * @param stats Recebe a estatística do envio (pode ser NULL).
+ * @return 0 (Sucesso), -2 (Timeout do DMA) ou -3 (Erro de hardware).
+ */
+int delta_upload(const uint8_t *frame, DeltaStats *stats);
+
+/**
+ * @brief Esquece o último quadro: o próximo delta_upload vai inteiro.
+ * Use quando a mem1 for escrita por fora (ASM_Store, ASM_Upload_Frame...).
+ */
+void delta_invalidate(void);
+
+/**
+ * @brief Libera a sombra e o buffer de DMA (volta ao estado inicial).
+ */
+void delta_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,936 @@
+/*
+ * =========================================================================
+ * emu.c: Emulador do Coprocessador (backend de software da api.h)
+ * =========================================================================
+ *
+ * Implementa todas as funções da api.h sem o DE1-SoC: no lugar do lib.s,
+ * este ficheiro é ligado ao programa e modela o FPGA/main.v em software.
+ *
+ * O modelo é fiel ao RTL, bit a bit:
+ * - as memórias (mem1 original, mem2..mem5 de exibição, em ping-pong sem
+ *   o cache; mem4 e mem5 só com ZOOM_CACHE_4BUF) com 19200 palavras de
+ *   32 bits (76800 pixels), como em mem1.v; o modelo guarda um byte por
+ *   pixel, na ordem das faixas da palavra (escrita fora da faixa é
+ *   ignorada e leitura fora da faixa devolve 0);
+ * - o buffer duplo: algoritmos e cópias da mem1 escrevem no buffer de
+ *   trás e os buffers trocam de papel no fim do comando. Sem VGA não há
+ *   espera pelo vsync: o EXT_VSYNC também troca no fim do comando;
+ * - a decisão do estado IDLE (current_zoom/next_zoom, com as comparações
+ *   feitas sobre o valor antigo do next_zoom, como nas atribuições <=);
+ * - os algoritmos seguem o mapeamento do zoom_stream.v (zoom in a partir
+ *   da vista do centro do zoom, recortada na imagem) e do
+ *   zoom_out_stream.v (decimação e média do bloco inteiro de 2x2, 4x4 ou
+ *   8x8 pixels, com a imagem reduzida na vista);
+ * - o zoom na varredura (EXT_SCAN): NHI/PR/NH só mudam o remapeamento do
+ *   VGA (scan_on, disp_zoom, pan) quando a frente tem a mem1 em 1x; sem
+ *   VGA não há varredura, só o estado. O emulador não vê as escritas pela
+ *   janela VRAM, então "mem1 escrita desde a última cópia" (base_dirty)
+ *   é a frente diferente da mem1;
+ * - o zoom fracionário (REFRESH + EXT_SCALE) do zoom_scale_stream.v:
+ *   mesmo passo em Q16, vizinho mais próximo no zoom in e média da área
+ *   no zoom out, com o nível do zoom na potência de 2 logo abaixo;
+ * - o zoom in bilinear (NHI + EXT_BILINEAR) do zoom_bilinear_stream.v,
+ *   com os mesmos pesos em oitavos e o mesmo arredondamento;
+ * - o cache de níveis (EXT_CACHE): mesmas chaves, mesma escolha do buffer
+ *   (livre, senão o usado há mais tempo) e mesmos contadores de acertos e
+ *   falhas, com 2 buffers como o main.v padrão (4 com -DZOOM_CACHE_4BUF). Como as escritas pela janela VRAM não passam pelo emulador, a
+ *   invalidação compara a mem1 com a do último preenchimento;
+ * - FLAG_DONE, FLAG_ERROR (só limpa no RESET), FLAG_ZOOM_MAX/MIN.
+ *
+ * Os ciclos de espera (WAIT_WR_OR_RD, COPY_READ, STREAM) não são simulados:
+ * cada comando termina dentro do pulso de ENABLE, então FLAG_DONE já está
+ * em 1 quando a função retorna.
+ *
+ * Uso: make emu (ver makefile).
+ *
+ */
+
+#include "api.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* ===================================================================
+ * Constantes do RTL
+ * =================================================================== */
+
+#define EMU_MEM_WORDS  19200  // numwords_a/b da mem1.v (palavras de 32 bits)
+#define EMU_MEM_PIXELS (EMU_MEM_WORDS * 4)
+#define EMU_MEM_SPAN  0x20000  // 128 KB por memória na janela VRAM
+
+// Instruções (INSTRUCTION[2:0])
+#define OP_REFRESH 0
+#define OP_LOAD    1
+#define OP_STORE   2
+#define OP_NHI_ALG 3
+#define OP_PR_ALG  4
+#define OP_BA_ALG  5
+#define OP_NH_ALG  6
+#define OP_RESET   7
+
+// Modificadores (INSTRUCTION[31:29])
+#define EXT_NONE   0
+#define EXT_PACKED 1
+#define EXT_DMA    2
+#define EXT_SPANS  3
+#define EXT_RLE    4
+#define EXT_VSYNC  5
+#define EXT_SCAN   6
+#define EXT_CACHE  1  // REFRESH
+#define EXT_LEVEL  4  // REFRESH
+#define EXT_CENTER 6  // REFRESH
+#define EXT_SCALE  7  // REFRESH
+#define EXT_BILINEAR 7  // NHI
+
+// Pool de DMA (mesmos valores do lib.s)
+#define DMA_POOL_BASE 0x3F000000u
+#define DMA_POOL_SPAN 0x01000000u
+
+#define R17(v) ((uint32_t)(v) & 0x1FFFFu)  // registrador de 17 bits
+
+// buffers de exibição do main.v (N_BUFS): mem2/mem3, ou até mem5 com a macro
+#ifdef ZOOM_CACHE_4BUF
+#define EMU_DISP_BUFS 4
+#else
+#define EMU_DISP_BUFS 2
+#endif
+
+/* ===================================================================
+ * Estado do FPGA (registradores do main.v)
+ * =================================================================== */
+
+typedef struct {
+    // alocadas com o tamanho da janela: escritas pelo ponteiro da VRAM
+    // acima de EMU_MEM_PIXELS caem no espaço que não existe no FPGA
+    uint8_t  mem1[EMU_MEM_SPAN];
+    uint8_t  disp[EMU_DISP_BUFS][EMU_MEM_SPAN]; // mem2..mem3 (ou mem5)
+    uint32_t front_buf, back_buf;
+
+    uint32_t last_instruction, last_ext;
+    uint32_t current_zoom, next_zoom;
+    int      flag_done, flag_error;
+    uint8_t  data_out;
+
+    // Zoom na varredura (EXT_SCAN)
+    int      scan_on, front_base;
+    uint32_t disp_zoom, pan_x, pan_y;
+
+    uint32_t scale_q8; // fator do último EXT_SCALE (8.8)
+    uint32_t center_x, center_y; // centro do zoom (EXT_CENTER)
+
+    // Cache de níveis (EXT_CACHE)
+    int      cache_on;
+    int      tag_valid[4];
+    uint64_t tag_key[4];
+    uint32_t buf_age[4];
+    uint32_t cache_hits, cache_misses;
+    uint8_t  cache_src[EMU_MEM_PIXELS]; // mem1 do último preenchimento
+} EmuFpga;
+
+// zerado, como os registradores após a configuração (valores do initial do main.v)
+static EmuFpga fpga = { .back_buf = 1, .center_x = 160, .center_y = 120, .buf_age = {0, 1, 2, 3} };
+
+// PIOs vistos pelo HPS
+static uint32_t pio_instruction;
+static uint32_t alg_ext; // API_Set_Scanout (no lib.s, alg_ext)
+static uint32_t pio_data;
+
+// Janela VRAM e pool de DMA
+static uint8_t *dma_pool;
+static uint32_t dma_pool_used;
+static int      initialized;
+
+/* ===================================================================
+ * Memórias
+ * =================================================================== */
+
+static uint8_t mem_read(const uint8_t *mem, uint32_t addr) {
+    addr = R17(addr);
+    return (addr < EMU_MEM_PIXELS) ? mem[addr] : 0;
+}
+
+static void mem_write(uint8_t *mem, uint32_t addr, uint8_t data) {
+    addr = R17(addr);
+    if (addr < EMU_MEM_PIXELS) {
+        mem[addr] = data;
+    }
+}
+
+static uint8_t *display_front(void) { return fpga.disp[fpga.front_buf]; }
+static uint8_t *display_back(void)  { return fpga.disp[fpga.back_buf]; }
+
+static int flag_zoom_max(void) { return fpga.current_zoom == 7; }
+static int flag_zoom_min(void) { return fpga.current_zoom == 1; }
+
+/* Vista de next_zoom (view_x/view_y do main.v): no zoom in, canto da
+ * janela de origem recortada na imagem (par no 2x); no zoom out, canto
+ * da imagem reduzida na tela (múltiplo de 4 em x); no 1x, (0, 0) */
+static void zoom_view(uint32_t *vx, uint32_t *vy) {
+    EmuFpga *f = &fpga;
+    uint32_t z = f->next_zoom;
+    if (z >= 5 && z <= 7) {
+        uint32_t s = z - 4;
+        uint32_t hx = 160 >> s, hy = 120 >> s;
+        uint32_t mx = 320 - (320 >> s), my = 240 - (240 >> s);
+        *vx = f->center_x < hx ? 0 : f->center_x - hx > mx ? mx : f->center_x - hx;
+        *vy = f->center_y < hy ? 0 : f->center_y - hy > my ? my : f->center_y - hy;
+        if (z == 5) {
+            *vx &= ~1u;
+        }
+    } else if (z >= 1 && z <= 3) {
+        uint32_t s = 4 - z;
+        *vx = (160 - (f->center_x >> s)) & ~3u;
+        *vy = 120 - (f->center_y >> s);
+    } else {
+        *vx = 0;
+        *vy = 0;
+    }
+}
+
+/* ===================================================================
+ * Estado STREAM: zoom_stream.v (vizinho mais próximo e replicação) e
+ * zoom_out_stream.v (decimação e média de blocos), com o mesmo mapeamento
+ * =================================================================== */
+
+static void zoom_stream(void) {
+    EmuFpga *f = &fpga;
+    uint32_t op = f->last_instruction;
+    uint32_t z = f->next_zoom;
+    uint8_t *back = display_back();
+
+    if (op == OP_NHI_ALG && f->last_ext == EXT_BILINEAR) {
+        // pesos em oitavos entre (sx, sy) e (sx + 1, sy + 1)
+        uint32_t s = (z == 5) ? 1 : (z == 6) ? 2 : 3;
+        uint32_t cx, cy;
+        uint32_t mask = (1u << s) - 1;
+        zoom_view(&cx, &cy);
+        for (uint32_t y = 0; y < 240; y++) {
+            uint32_t sy = cy + (y >> s), sy1 = (sy == 239) ? 239 : sy + 1;
+            uint32_t wy = (y & mask) << (3 - s);
+            for (uint32_t x = 0; x < 320; x++) {
+                uint32_t sx = cx + (x >> s), sx1 = (sx == 319) ? 319 : sx + 1;
+                uint32_t wx = (sx == 319) ? 0 : (x & mask) << (3 - s);
+                uint32_t acc = (8 - wx) * (8 - wy) * mem_read(f->mem1, sy * 320 + sx) +
+                               wx * (8 - wy) * mem_read(f->mem1, sy * 320 + sx1) +
+                               (8 - wx) * wy * mem_read(f->mem1, sy1 * 320 + sx) +
+                               wx * wy * mem_read(f->mem1, sy1 * 320 + sx1);
+                mem_write(back, y * 320 + x, (uint8_t)((acc + 32) >> 6));
+            }
+        }
+        return;
+    }
+
+    if (op == OP_NHI_ALG || op == OP_PR_ALG) {
+        uint32_t s = (z == 5) ? 1 : (z == 6) ? 2 : 3;
+        uint32_t cx, cy;
+        zoom_view(&cx, &cy);
+        for (uint32_t y = 0; y < 240; y++) {
+            for (uint32_t x = 0; x < 320; x++) {
+                mem_write(back, y * 320 + x, mem_read(f->mem1, (cy + (y >> s)) * 320 + cx + (x >> s)));
+            }
+        }
+        return;
+    }
+
+    // zoom out: imagem de (320 >> s) x (240 >> s) na vista, zero fora dela
+    uint32_t s = (z == 3) ? 1 : (z == 2) ? 2 : 3;
+    uint32_t x_lo, y_lo;
+    zoom_view(&x_lo, &y_lo);
+    uint32_t x_hi = x_lo + (320 >> s) - 1, y_hi = y_lo + (240 >> s) - 1;
+    uint32_t b = 1u << s; // lado do bloco
+    for (uint32_t y = 0; y < 240; y++) {
+        for (uint32_t x = 0; x < 320; x++) {
+            uint8_t px = 0;
+            if (x >= x_lo && x <= x_hi && y >= y_lo && y <= y_hi) {
+                uint32_t src = ((y - y_lo) << s) * 320 + ((x - x_lo) << s);
+                if (op == OP_BA_ALG) {
+                    uint32_t sum = 0;
+                    for (uint32_t j = 0; j < b; j++) {
+                        for (uint32_t i = 0; i < b; i++) {
+                            sum += mem_read(f->mem1, src + j * 320 + i);
+                        }
+                    }
+                    px = (uint8_t)(sum >> (2 * s));
+                } else {
+                    px = mem_read(f->mem1, src);
+                }
+            }
+            mem_write(back, y * 320 + x, px);
+        }
+    }
+}
+
+// Recorte de [lo, hi) na faixa [0, max]
+static int32_t clip(int32_t v, int32_t max) { return v < 0 ? 0 : v > max ? max : v; }
+
+// piso e teto de um Q16 com sinal
+static int32_t q16_floor(int32_t v) { return (int32_t)((int64_t)v >> 16); }
+static int32_t q16_ceil(int32_t v)  { return (int32_t)(((int64_t)v + 65535) >> 16); }
+
+// Recorte de v entre 0 e e (e pode ser negativo)
+static int32_t clamp_q16(int32_t v, int32_t e) {
+    int32_t lo = e < 0 ? e : 0, hi = e < 0 ? 0 : e;
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+/* zoom_scale_stream.v: passo 2^24 / scale em Q16 a partir da origem do
+ * centro do zoom, recortada para a imagem cobrir a tela (zoom in) ou
+ * caber nela (zoom out); vizinho mais próximo no zoom in, média da área
+ * no zoom out */
+static void zoom_scale(void) {
+    EmuFpga *f = &fpga;
+    uint8_t *back = display_back();
+    int32_t step = (int32_t)((1u << 24) / f->scale_q8);
+    int up = f->scale_q8 >= 0x100;
+    int32_t ax0 = clamp_q16(((int32_t)f->center_x << 16) - 160 * step, (320 << 16) - 320 * step);
+    int32_t ay = clamp_q16(((int32_t)f->center_y << 16) - 120 * step, (240 << 16) - 240 * step);
+
+    for (int32_t y = 0; y < 240; y++, ay += step) {
+        int32_t ax = ax0;
+        int32_t ylo = clip(up ? q16_floor(ay) : q16_ceil(ay), 240);
+        int32_t yhi = clip(up ? q16_floor(ay) + 1 : q16_ceil(ay + step), 240);
+        for (int32_t x = 0; x < 320; x++, ax += step) {
+            int32_t xlo = clip(up ? q16_floor(ax) : q16_ceil(ax), 320);
+            int32_t xhi = clip(up ? q16_floor(ax) + 1 : q16_ceil(ax + step), 320);
+            uint8_t px = 0;
+            if (xhi > xlo && yhi > ylo) {
+                uint32_t sum = 0;
+                for (int32_t j = ylo; j < yhi; j++) {
+                    for (int32_t i = xlo; i < xhi; i++) {
+                        sum += mem_read(f->mem1, j * 320 + i);
+                    }
+                }
+                px = (uint8_t)(sum / ((xhi - xlo) * (yhi - ylo)));
+            }
+            mem_write(back, y * 320 + x, px);
+        }
+    }
+}
+
+/* ===================================================================
+ * Cache de níveis: chaves e escolha do buffer de trás, como no main.v
+ * =================================================================== */
+
+#define KEY_1X ((uint64_t)4 << 35)
+
+// {nível, algoritmo, posição, fator} do quadro pedido (cache_key)
+static uint64_t cache_key(void) {
+    EmuFpga *f = &fpga;
+    uint32_t vx, vy, alg;
+    if (f->last_instruction == OP_REFRESH && f->last_ext == EXT_SCALE) {
+        return ((uint64_t)f->next_zoom << 35) | ((uint64_t)3 << 33) | ((uint64_t)f->center_x << 24) |
+               ((uint64_t)f->center_y << 16) | f->scale_q8;
+    }
+    if (f->last_instruction == OP_RESET) {
+        return KEY_1X;
+    }
+    alg = (f->last_instruction == OP_BA_ALG) ? 1 : (f->last_instruction == OP_NHI_ALG && f->last_ext == EXT_BILINEAR) ? 2 : 0;
+    zoom_view(&vx, &vy);
+    return ((uint64_t)f->next_zoom << 35) | ((uint64_t)alg << 33) | ((uint64_t)vx << 24) | ((uint64_t)vy << 16);
+}
+
+// escrita na mem1 desde o último preenchimento: invalida todos
+static void cache_check_mem1(void) {
+    EmuFpga *f = &fpga;
+    if (memcmp(f->cache_src, f->mem1, EMU_MEM_PIXELS) != 0) {
+        memset(f->tag_valid, 0, sizeof(f->tag_valid));
+        memcpy(f->cache_src, f->mem1, EMU_MEM_PIXELS);
+    }
+}
+
+// início de um preenchimento: buffer livre, senão o usado há mais tempo
+static void fill_begin(void) {
+    EmuFpga *f = &fpga;
+    cache_check_mem1();
+    if (f->cache_on) {
+        uint32_t victim = f->back_buf;
+        for (uint32_t k = 0; k < EMU_DISP_BUFS; k++) {
+            if (k != f->front_buf && f->buf_age[k] == EMU_DISP_BUFS - 1) {
+                victim = k;
+            }
+        }
+        for (uint32_t k = 0; k < EMU_DISP_BUFS; k++) {
+            if (k != f->front_buf && !f->tag_valid[k]) {
+                victim = k;
+            }
+        }
+        f->back_buf = victim;
+    }
+    f->tag_valid[f->back_buf] = 0;
+}
+
+static void fill_end(uint64_t key) {
+    fpga.tag_key[fpga.back_buf] = key;
+    fpga.tag_valid[fpga.back_buf] = fpga.cache_on;
+}
+
+// troca da frente (flip_now ou vsync), com a idade dos buffers
+static void swap_buffers(void) {
+    EmuFpga *f = &fpga;
+    uint32_t nf = f->back_buf;
+    for (uint32_t k = 0; k < EMU_DISP_BUFS; k++) {
+        if (k != nf && f->buf_age[k] < f->buf_age[nf]) {
+            f->buf_age[k]++;
+        }
+    }
+    f->buf_age[nf] = 0;
+    f->back_buf = f->front_buf;
+    f->front_buf = nf;
+}
+
+// Fim do comando: os buffers trocam de papel, current_zoom <= next_zoom
+static void flip(void) {
+    swap_buffers();
+    fpga.current_zoom = fpga.next_zoom;
+    fpga.flag_done = 1;
+}
+
+// Remapeamento da varredura para next_zoom, a partir da vista do centro
+static void set_scan(void) {
+    EmuFpga *f = &fpga;
+    f->disp_zoom = f->next_zoom;
+    zoom_view(&f->pan_x, &f->pan_y);
+}
+
+// COPY_READ: mem1 -> buffer de trás (RESET, REFRESH e volta ao 1x)
+static void copy_to_back(void) {
+    fill_begin();
+    memcpy(display_back(), fpga.mem1, EMU_MEM_PIXELS);
+    fill_end(KEY_1X);
+    flip();
+    fpga.front_base = 1;
+    if (fpga.last_ext == EXT_SCAN) {
+        fpga.scan_on = 1;
+    }
+    set_scan();
+}
+
+static void run_algorithm(void) {
+    EmuFpga *f = &fpga;
+    f->flag_done = 0;
+    if (f->last_ext == EXT_SCAN && f->last_instruction != OP_BA_ALG) {
+        if (f->front_base && memcmp(display_front(), f->mem1, EMU_MEM_PIXELS) == 0) {
+            f->scan_on = 1;
+            set_scan();
+            f->current_zoom = f->next_zoom;
+            f->flag_done = 1;
+        } else {
+            copy_to_back();
+        }
+        return;
+    }
+    cache_check_mem1();
+    uint64_t key = cache_key();
+    for (uint32_t k = 0; f->cache_on && k < EMU_DISP_BUFS; k++) {
+        if (f->tag_valid[k] && f->tag_key[k] == key) {
+            // acerto: só troca a frente
+            if (k != f->front_buf) {
+                f->back_buf = k;
+                swap_buffers();
+            }
+            f->cache_hits++;
+            f->current_zoom = f->next_zoom;
+            f->scan_on = 0;
+            f->front_base = (key == KEY_1X);
+            set_scan();
+            f->flag_done = 1;
+            return;
+        }
+    }
+    f->cache_misses += f->cache_on;
+    if (f->last_instruction == OP_RESET) {
+        copy_to_back();
+        return;
+    }
+    fill_begin();
+    if (f->last_instruction == OP_REFRESH && f->last_ext == EXT_SCALE) {
+        zoom_scale();
+    } else {
+        zoom_stream();
+    }
+    fill_end(key);
+    flip();
+    f->scan_on = 0;
+    f->front_base = 0;
+}
+
+/* ===================================================================
+ * Estado IDLE: decodifica o comando no pulso de ENABLE
+ * =================================================================== */
+
+// Decisão de zoom do IDLE; retorna o próximo estado (algoritmo, cópia ou nada)
+enum { GO_IDLE, GO_ALGORITHM, GO_COPY };
+
+static int zoom_decision(uint32_t op) {
+    EmuFpga *f = &fpga;
+    uint32_t cz = f->current_zoom;
+    uint32_t nz_old = f->next_zoom; // as comparações usam o valor antigo
+    int zoom_in = (op == OP_NHI_ALG || op == OP_PR_ALG);
+
+    if ((zoom_in && flag_zoom_max()) || (!zoom_in && flag_zoom_min())) {
+        f->flag_done = 1;
+        return GO_IDLE;
+    }
+
+    f->next_zoom = (zoom_in ? cz + 1 : cz - 1) & 0x7;
+
+    if (zoom_in) {
+        uint32_t in_alg  = (op == OP_NHI_ALG) ? OP_NHI_ALG : OP_PR_ALG;
+        uint32_t out_alg = (op == OP_NHI_ALG) ? OP_NH_ALG : OP_BA_ALG;
+        if (cz == 3) {
+            f->last_instruction = OP_RESET;
+            return GO_COPY;
+        } else if (cz >= 4) {
+            f->last_instruction = in_alg;
+            return GO_ALGORITHM;
+        } else if (op == OP_NHI_ALG ? nz_old < 4 : cz < 4) {
+            f->last_instruction = out_alg;
+            return GO_ALGORITHM;
+        }
+    } else {
+        uint32_t out_alg = (op == OP_NH_ALG) ? OP_NH_ALG : OP_BA_ALG;
+        uint32_t in_alg  = (op == OP_NH_ALG) ? OP_NHI_ALG : OP_PR_ALG;
+        if (cz == 5) {
+            f->last_instruction = OP_RESET;
+            return GO_COPY;
+        } else if (cz <= 4) {
+            f->last_instruction = out_alg;
+            return GO_ALGORITHM;
+        } else if (op == OP_NH_ALG ? nz_old > 4 : cz > 4) {
+            f->last_instruction = in_alg;
+            return GO_ALGORITHM;
+        }
+    }
+    return GO_IDLE;
+}
+
+// Pulso de ENABLE: decodificação do ghrd_top.v + estado IDLE do main.v
+static void enable_pulse(void) {
+    EmuFpga *f = &fpga;
+    uint32_t op       = pio_instruction & 0x7;
+    uint32_t ext      = pio_instruction >> 29;
+    int      rw       = (op == OP_STORE || op == OP_LOAD);
+    int      param_op = (op == OP_REFRESH && ext != EXT_NONE && ext != EXT_VSYNC);
+    uint32_t mem_addr = (rw || param_op) ? (pio_instruction >> 3) & 0x1FFFF : 0;
+    uint8_t  data_in  = rw ? (uint8_t)(pio_instruction >> 21) : 0;
+    int      sel_mem  = (op == OP_LOAD) ? (pio_instruction >> 20) & 1 : 0;
+
+    if (op == OP_STORE && (ext == EXT_DMA || ext == EXT_SPANS || ext == EXT_RLE)) {
+        // DMA: pio_DATA = endereço físico, MEM_ADDR = tamanho em bytes
+        if ((ext == EXT_DMA && mem_addr > 76800) || (ext == EXT_SPANS && (mem_addr & 3))) {
+            f->flag_error = 1;
+            return;
+        }
+        f->last_instruction = OP_STORE;
+        if (dma_pool && pio_data >= DMA_POOL_BASE && pio_data - DMA_POOL_BASE + mem_addr <= DMA_POOL_SPAN) {
+            const uint8_t *src = dma_pool + (pio_data - DMA_POOL_BASE);
+            if (ext == EXT_DMA) {
+                for (uint32_t i = 0; i < mem_addr; i++) {
+                    mem_write(f->mem1, i, src[i]);
+                }
+            } else if (ext == EXT_RLE) {
+                // c < 128: c + 1 literais; c >= 128: próximo byte repetido c - 126 vezes
+                uint32_t pos = 0, out = 0;
+                while (pos < mem_addr) {
+                    uint8_t c = src[pos++];
+                    if (c & 0x80) {
+                        for (uint32_t i = 0; i < c - 126u && pos < mem_addr; i++) {
+                            mem_write(f->mem1, out++, src[pos]);
+                        }
+                        pos++;
+                    } else {
+                        for (uint32_t i = 0; i <= c && pos < mem_addr; i++) {
+                            mem_write(f->mem1, out++, src[pos++]);
+                        }
+                    }
+                }
+            } else {
+                // lista de trechos: cabeçalho (endereço[16:0], tamanho[31:17]) + pixels, em palavras
+                uint32_t pos = 0;
+                while (pos + 4 <= mem_addr) {
+                    uint32_t head = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16) | ((uint32_t)src[pos + 3] << 24);
+                    uint32_t addr = head & 0x1FFFF, len = head >> 17;
+                    pos += 4;
+                    for (uint32_t i = 0; i < len && pos + i < mem_addr; i++) {
+                        mem_write(f->mem1, addr + i, src[pos + i]);
+                    }
+                    pos += (len + 3) & ~3u;
+                }
+            }
+        }
+        f->flag_done = 1;
+        return;
+    }
+
+    if (rw) {
+        // READ_AND_WRITE + WAIT_WR_OR_RD
+        f->last_instruction = op;
+        if (mem_addr > 76799 || (op == OP_STORE && ext == EXT_PACKED && mem_addr > 76796)) {
+            f->flag_error = 1;
+        }
+        if (op == OP_STORE && ext == EXT_PACKED) {
+            for (uint32_t i = 0; i < 4; i++) {
+                mem_write(f->mem1, mem_addr + i, (uint8_t)(pio_data >> (8 * i)));
+            }
+        } else if (op == OP_STORE) {
+            mem_write(f->mem1, mem_addr, data_in);
+        } else {
+            f->data_out = mem_read(sel_mem ? display_back() : f->mem1, mem_addr);
+        }
+        f->flag_done = 1;
+        return;
+    }
+
+    switch (op) {
+        case OP_NHI_ALG:
+        case OP_PR_ALG:
+        case OP_BA_ALG:
+        case OP_NH_ALG:
+            f->last_ext = ext;
+            switch (zoom_decision(op)) {
+                case GO_ALGORITHM: run_algorithm(); break;
+                // a volta ao 1x também passa pelo ALGORITHM (EXT_SCAN e cache)
+                case GO_COPY:      run_algorithm(); break;
+                default:           break;
+            }
+            break;
+        case OP_RESET:
+            f->next_zoom = 4;
+            f->flag_error = 0;
+            f->last_instruction = OP_RESET;
+            f->last_ext = EXT_NONE;
+            f->scan_on = 0;
+            f->center_x = 160;
+            f->center_y = 120;
+            memset(f->tag_valid, 0, sizeof(f->tag_valid));
+            copy_to_back();
+            break;
+        case OP_REFRESH:
+            if (ext == EXT_LEVEL) {
+                // salto direto: {scan, alg[1:0], nível}; uma passada a partir da mem1
+                uint32_t level = mem_addr & 7, alg = (mem_addr >> 3) & 3;
+                uint32_t scan_ext = (mem_addr & 0x20) ? EXT_SCAN : EXT_NONE;
+                if (level == 0 || alg == 3) {
+                    f->flag_error = 1;
+                    break;
+                }
+                f->next_zoom = level;
+                if (level == 4) {
+                    f->last_instruction = OP_RESET;
+                    f->last_ext = scan_ext;
+                    run_algorithm();
+                    break;
+                }
+                if (level > 4) {
+                    f->last_instruction = (alg == 1) ? OP_PR_ALG : OP_NHI_ALG;
+                    f->last_ext = (alg == 2) ? EXT_BILINEAR : scan_ext;
+                } else {
+                    f->last_instruction = (alg == 1) ? OP_BA_ALG : OP_NH_ALG;
+                    f->last_ext = scan_ext;
+                }
+                run_algorithm();
+                break;
+            }
+            if (ext == EXT_CACHE) {
+                // liga/desliga; nos dois casos o cache começa vazio
+                f->cache_on = mem_addr & 1;
+                memset(f->tag_valid, 0, sizeof(f->tag_valid));
+                break;
+            }
+            if (ext == EXT_CENTER) {
+                // só o registrador (e o pan da varredura), sem cópia
+                uint32_t x = mem_addr & 0x1FF, y = mem_addr >> 9;
+                if (x > 319 || y > 239) {
+                    f->flag_error = 1;
+                    break;
+                }
+                f->center_x = x;
+                f->center_y = y;
+                zoom_view(&f->pan_x, &f->pan_y);
+                break;
+            }
+            if (ext == EXT_SCALE) {
+                // fator em MEM_ADDR[15:0]; o nível é o da potência de 2 logo abaixo
+                uint32_t q8 = mem_addr & 0xFFFF;
+                if ((mem_addr >> 16) || q8 < 0x20 || q8 > 0x800) {
+                    f->flag_error = 1;
+                    break;
+                }
+                f->scale_q8 = q8;
+                f->next_zoom = 1;
+                while (f->next_zoom < 7 && (q8 >> (f->next_zoom + 5))) {
+                    f->next_zoom++;
+                }
+                f->last_instruction = OP_REFRESH;
+                f->last_ext = ext;
+                run_algorithm();
+                break;
+            }
+            // com ou sem EXT_VSYNC: aqui o vsync é imediato
+            f->last_instruction = OP_RESET;
+            f->last_ext = ext;
+            copy_to_back();
+            break;
+    }
+}
+
+/* ===================================================================
+ * api.h: Inicialização
+ * =================================================================== */
+
+static uint32_t fake_lw_bridge[0x50 / 4]; // devolvido como "ponteiro da ponte"
+
+volatile void* API_initialize(void) {
+    initialized = 1;
+    fpga.flag_done = 1; // a FSM parte do IDLE
+    return fake_lw_bridge;
+}
+
+volatile uint8_t* API_Get_VRAM(void) {
+    // só a mem1 aceita escrita pela janela; leitura das outras é por API_Read_Frame
+    return initialized ? fpga.mem1 : NULL;
+}
+
+void API_close(void) {
+    free(dma_pool);
+    dma_pool = NULL;
+    dma_pool_used = 0;
+    initialized = 0;
+}
+
+/* ===================================================================
+ * api.h: STORE / LOAD
+ * =================================================================== */
+
+static int wait_result(void) {
+    return fpga.flag_error ? -3 : 0;
+}
+
+int ASM_Store(unsigned int address, unsigned char pixel_data) {
+    if (address >= IMG_SIZE) {
+        return -1;
+    }
+    pio_instruction = OP_STORE | (address << 3) | (1u << 20) | ((uint32_t)pixel_data << 21);
+    enable_pulse();
+    return wait_result();
+}
+
+int ASM_Store_Packed(unsigned int address, uint32_t pixels) {
+    if (address >= IMG_SIZE - 3) {
+        return -1;
+    }
+    pio_data = pixels;
+    pio_instruction = OP_STORE | (address << 3) | (1u << 20) | ((uint32_t)EXT_PACKED << 29);
+    enable_pulse();
+    return wait_result();
+}
+
+int ASM_Store_Block(unsigned int start_addr, const uint8_t *buf, size_t n) {
+    if (start_addr >= IMG_SIZE || n > IMG_SIZE - start_addr) {
+        return -1;
+    }
+    size_t i = 0;
+    for (; n - i >= 4; i += 4) {
+        uint32_t px = buf[i] | (buf[i + 1] << 8) | (buf[i + 2] << 16) | ((uint32_t)buf[i + 3] << 24);
+        if (ASM_Store_Packed(start_addr + i, px) != 0) {
+            return -3;
+        }
+    }
+    for (; i < n; i++) {
+        if (ASM_Store(start_addr + i, buf[i]) != 0) {
+            return -3;
+        }
+    }
+    return 0;
+}
+
+int ASM_Upload_Frame(const uint8_t *buf) {
+    if (!initialized || ((uintptr_t)buf & 3)) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < IMG_SIZE; i++) {
+        mem_write(fpga.mem1, i, buf[i]);
+    }
+    return 0;
+}
+
+int ASM_Load(unsigned int address, unsigned int sel_mem) {
+    if (address >= IMG_SIZE) {
+        return -1;
+    }
+    pio_instruction = OP_LOAD | (address << 3) | ((sel_mem & 1) << 20);
+    enable_pulse();
+    return fpga.flag_error ? -3 : fpga.data_out;
+}
+
+int API_Read_Frame(int which_mem, uint8_t *buf) {
+    const uint8_t *mems[3] = {fpga.mem1, display_back(), display_front()}; // MEM_ORIGINAL, MEM_WORK, MEM_DISPLAY
+
+    if (!initialized || which_mem < 0 || which_mem > 2 || ((uintptr_t)buf & 3)) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < IMG_SIZE; i++) {
+        buf[i] = mem_read(mems[which_mem], i);
+    }
+    return 0;
+}
+
+/* ===================================================================
+ * api.h: DMA
+ * =================================================================== */
+
+void* API_Dma_Alloc(size_t size, uint32_t *phys) {
+    size_t rounded = (size + 0xFFF) & ~(size_t)0xFFF;
+
+    if (!dma_pool) {
+        dma_pool = calloc(1, DMA_POOL_SPAN);
+        if (!dma_pool) {
+            return NULL;
+        }
+    }
+    if (dma_pool_used + rounded > DMA_POOL_SPAN) {
+        return NULL;
+    }
+    if (phys) {
+        *phys = DMA_POOL_BASE + dma_pool_used;
+    }
+    void *ptr = dma_pool + dma_pool_used;
+    dma_pool_used += rounded;
+    return ptr;
+}
+
+void API_Dma_Free_All(void) {
+    dma_pool_used = 0;
+}
+
+int ASM_Dma_Upload(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || n > IMG_SIZE) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_DMA << 29);
+    enable_pulse();
+    return 0;
+}
+
+int ASM_Dma_Upload_Rle(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || n > 0x1FFFF) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_RLE << 29);
+    enable_pulse();
+    return 0;
+}
+
+int ASM_Dma_Upload_Spans(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || (n & 3) || n > 0x1FFFF) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_SPANS << 29);
+    enable_pulse();
+    return 0;
+}
+
+/* ===================================================================
+ * api.h: Comandos e Algoritmos
+ * =================================================================== */
+
+void ASM_Refresh(void) {
+    pio_instruction = OP_REFRESH;
+    enable_pulse();
+}
+
+void ASM_Refresh_Vsync(void) {
+    pio_instruction = OP_REFRESH | ((uint32_t)EXT_VSYNC << 29);
+    enable_pulse();
+}
+
+void ASM_Pulse_Enable(void) {
+    enable_pulse();
+}
+
+void NearestNeighbor(void)  { pio_instruction = OP_NHI_ALG | alg_ext; }
+void PixelReplication(void) { pio_instruction = OP_PR_ALG | alg_ext; }
+void Decimation(void)       { pio_instruction = OP_NH_ALG | alg_ext; }
+void BlockAveraging(void)   { pio_instruction = OP_BA_ALG | alg_ext; }
+void BilinearZoom(void)     { pio_instruction = OP_NHI_ALG | ((uint32_t)EXT_BILINEAR << 29); }
+
+void API_Set_Scanout(int enable) {
+    alg_ext = enable ? (uint32_t)EXT_SCAN << 29 : 0;
+}
+
+int API_Zoom_To(unsigned int scale_q8) {
+    if (scale_q8 < ZOOM_SCALE_MIN || scale_q8 > ZOOM_SCALE_MAX) {
+        return -1;
+    }
+    pio_instruction = OP_REFRESH | (scale_q8 << 3) | ((uint32_t)EXT_SCALE << 29);
+    ASM_Pulse_Enable();
+    return 0;
+}
+
+int API_Set_Zoom(unsigned int level, unsigned int alg) {
+    if (level < ZOOM_LEVEL_MIN || level > ZOOM_LEVEL_MAX || alg > ZOOM_ALG_BILINEAR) {
+        return -1;
+    }
+    uint32_t arg = level | (alg << 3) | (alg_ext ? 0x20 : 0);
+    pio_instruction = OP_REFRESH | (arg << 3) | ((uint32_t)EXT_LEVEL << 29);
+    ASM_Pulse_Enable();
+    return 0;
+}
+
+void API_Set_Zoom_Cache(int enable) {
+    pio_instruction = OP_REFRESH | ((enable ? 1u : 0u) << 3) | ((uint32_t)EXT_CACHE << 29);
+    ASM_Pulse_Enable();
+}
+
+int API_Get_Zoom_Cache_Stats(uint32_t *hits, uint32_t *misses) {
+    if (!initialized || !hits || !misses) {
+        return -1;
+    }
+    *hits = fpga.cache_hits;
+    *misses = fpga.cache_misses;
+    return 0;
+}
+
+int API_Set_Zoom_Center(unsigned int x, unsigned int y) {
+    if (x >= IMG_WIDTH || y >= IMG_HEIGHT) {
+        return -1;
+    }
+    pio_instruction = OP_REFRESH | ((x | (y << 9)) << 3) | ((uint32_t)EXT_CENTER << 29);
+    ASM_Pulse_Enable();
+    return 0;
+}
+
+void ASM_Reset(void) {
+    pio_instruction = OP_RESET;
+    enable_pulse();
+}
+
+/* ===================================================================
+ * api.h: Interrupção e Flags
+ * =================================================================== */
+
+int API_Get_Irq_Fd(void) {
+    return -1; // sem /dev/uio0
+}
+
+int API_Irq_Rearm(void) {
+    return -1;
+}
+
+int API_Wait_Done(unsigned int timeout_us) {
+    (void)timeout_us;
+    // os comandos terminam dentro do pulso: não há o que esperar
+    return fpga.flag_error ? -3 : 0;
+}
+
+int API_Read_Perf_Counters(PerfCounters *out) {
+    (void)out;
+    return -1; // o emulador não conta ciclos: use o sim_test
+}
+
+int ASM_Get_Flag_Done(void)     { return fpga.flag_done; }
+int ASM_Get_Flag_Error(void)    { return fpga.flag_error; }
+int ASM_Get_Flag_Max_Zoom(void) { return flag_zoom_max(); }
+int ASM_Get_Flag_Min_Zoom(void) { return flag_zoom_min(); }
@@ -0,0 +1,181 @@
+#include "image_io.h"
+#include "api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Estrutura do cabeçalho BMP (14 bytes)
+#pragma pack(push, 1)
+typedef struct {
+    uint16_t type;
+    uint32_t size;
+    uint16_t reserved1;
+    uint16_t reserved2;
+    uint32_t offset;
+} BMPHeader;
+
+typedef struct {
+    uint32_t size;
+    int32_t  width;
+    int32_t  height;
+    uint16_t planes;
+    uint16_t bits;
+    uint32_t compression;
+    uint32_t imagesize;
+    int32_t  xresolution;
+    int32_t  yresolution;
+    uint32_t ncolours;
+    uint32_t importantcolours;
+} BMPInfoHeader;
+#pragma pack(pop)
+
+// Converte RGB para Grayscale
+static uint8_t rgb_to_gray(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint8_t)((299 * r + 587 * g + 114 * b) / 1000);
+}
+
+// Carrega imagem BMP (320x240; 8, 24 ou 32 bits) como tons de cinza
+int load_bmp(const char *filename, uint8_t *image_data) {
+    FILE *file;
+    BMPHeader header;
+    BMPInfoHeader infoHeader;
+    
+    file = fopen(filename, "rb");
+    if (!file) {
+        printf("❌ Erro ao abrir '%s'\n", filename);
+        return -1;
+    }
+    
+    fread(&header, sizeof(BMPHeader), 1, file);
+    if (header.type != 0x4D42) {
+        printf("❌ Arquivo não é BMP válido\n");
+        fclose(file);
+        return -1;
+    }
+    
+    fread(&infoHeader, sizeof(BMPInfoHeader), 1, file);
+    
+    if (infoHeader.width != IMG_WIDTH || abs(infoHeader.height) != IMG_HEIGHT) {
+        printf("❌ Dimensão incorreta: %dx%d (esperado 320x240)\n", 
+               infoHeader.width, abs(infoHeader.height));
+        fclose(file);
+        return -1;
+    }
+    
+    fseek(file, header.offset, SEEK_SET);
+    
+    int bytes_per_pixel = infoHeader.bits / 8;
+    int row_size = ((infoHeader.width * bytes_per_pixel + 3) / 4) * 4;
+    uint8_t *row_data = (uint8_t*)malloc(row_size);
+    
+    for (int y = 0; y < IMG_HEIGHT; y++) {
+        fread(row_data, 1, row_size, file);
+        
+        for (int x = 0; x < IMG_WIDTH; x++) {
+            uint8_t gray;
+            
+            if (infoHeader.bits == 32) {
+                uint8_t b = row_data[x * 4 + 0];
+                uint8_t g = row_data[x * 4 + 1];
+                uint8_t r = row_data[x * 4 + 2];
+                gray = rgb_to_gray(r, g, b);
+            } else if (infoHeader.bits == 24) {
+                uint8_t b = row_data[x * 3 + 0];
+                uint8_t g = row_data[x * 3 + 1];
+                uint8_t r = row_data[x * 3 + 2];
+                gray = rgb_to_gray(r, g, b);
+            } else if (infoHeader.bits == 8) {
+                gray = row_data[x];
+            } else {
+                printf("\n❌ Formato %d bits não suportado\n", infoHeader.bits);
+                free(row_data);
+                fclose(file);
+                return -1;
+            }
+            
+            int addr = (IMG_HEIGHT - 1 - y) * IMG_WIDTH + x;
+            image_data[addr] = gray;
+        }
+    }
+    
+    free(row_data);
+    fclose(file);
+    return 0;
+}
+
+// Salva quadro como PGM (P5)
+int save_pgm(const char *filename, const uint8_t *frame, int width, int height) {
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "P5\n%d %d\n255\n", width, height);
+    size_t total = (size_t)width * height;
+    int ok = (fwrite(frame, 1, total, file) == total);
+
+    if (fclose(file) != 0) {
+        ok = 0;
+    }
+    return ok ? 0 : -1;
+}
+
+// Escreve inteiros little-endian (cabeçalho BMP)
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    put_u16(p, (uint16_t)v);
+    put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+// Salva quadro como BMP 8 bits com paleta de cinza
+int save_bmp(const char *filename, const uint8_t *frame, int width, int height) {
+    uint8_t header[14 + 40];
+    uint8_t palette[256 * 4];
+    uint8_t pad[3] = {0, 0, 0};
+    int row_size = (width + 3) & ~3;
+    uint32_t data_offset = sizeof(header) + sizeof(palette);
+    uint32_t image_size = (uint32_t)row_size * height;
+
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    // Cabeçalho do arquivo (14 bytes) + cabeçalho de informação (40 bytes)
+    memset(header, 0, sizeof(header));
+    header[0] = 'B';
+    header[1] = 'M';
+    put_u32(header + 2, data_offset + image_size);
+    put_u32(header + 10, data_offset);
+    put_u32(header + 14, 40);
+    put_u32(header + 18, (uint32_t)width);
+    put_u32(header + 22, (uint32_t)height);   // positivo: linhas de baixo para cima
+    put_u16(header + 26, 1);
+    put_u16(header + 28, 8);
+    put_u32(header + 34, image_size);
+    put_u32(header + 46, 256);
+
+    for (int i = 0; i < 256; i++) {
+        palette[i * 4 + 0] = (uint8_t)i;
+        palette[i * 4 + 1] = (uint8_t)i;
+        palette[i * 4 + 2] = (uint8_t)i;
+        palette[i * 4 + 3] = 0;
+    }
+
+    int ok = (fwrite(header, 1, sizeof(header), file) == sizeof(header)) &&
+             (fwrite(palette, 1, sizeof(palette), file) == sizeof(palette));
+
+    for (int y = height - 1; ok && y >= 0; y--) {
+        ok = (fwrite(frame + (size_t)y * width, 1, width, file) == (size_t)width) &&
+             (fwrite(pad, 1, row_size - width, file) == (size_t)(row_size - width));
+    }
+
+    if (fclose(file) != 0) {
+        ok = 0;
+    }
+    return ok ? 0 : -1;
+}
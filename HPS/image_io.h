@@ -0,0 +1,48 @@
+/*
+ * =========================================================================
+ * image_io.h: Leitura e Gravação de Quadros em Arquivo
+ * =========================================================================
+ *
+ * Lê e grava quadros em tons de cinza (1 byte por pixel, linha a linha,
+ * como nas memórias do FPGA). O load_bmp prepara a imagem para envio;
+ * save_pgm/save_bmp, junto de API_Read_Frame, permitem conferir o que o
+ * coprocessador produziu.
+ *
+ * #include "image_io.h"
+ *
+ */
+
+#ifndef IMAGE_IO_H_
+#define IMAGE_IO_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Carrega um BMP de IMG_WIDTH x IMG_HEIGHT (8, 24 ou 32 bits) em tons de cinza.
+ * @param image_data Destino de IMG_SIZE bytes.
+ * @return 0 (Sucesso) ou -1 (arquivo inválido; a causa é impressa).
+ */
+int load_bmp(const char *filename, uint8_t *image_data);
+
+/**
+ * @brief Salva o quadro como PGM binário (P5, 8 bits).
+ * @return 0 (Sucesso) ou -1 (erro ao criar/escrever o arquivo).
+ */
+int save_pgm(const char *filename, const uint8_t *frame, int width, int height);
+
+/**
+ * @brief Salva o quadro como BMP de 8 bits com paleta de cinza.
+ * O arquivo pode ser lido de volta pelo load_bmp.
+ * @return 0 (Sucesso) ou -1 (erro ao criar/escrever o arquivo).
+ */
+int save_bmp(const char *filename, const uint8_t *frame, int width, int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -4,10 +4,13 @@
 
 @ --- SYSCALLS (ARM Linux EABI) ---
 
+.equ __NR_read, 3
+.equ __NR_write, 4
 .equ __NR_open, 5
 .equ __NR_close, 6
 .equ __NR_munmap, 91
 .equ __NR_mmap2, 192
+.equ __NR_ppoll, 336
 
 @ ===================================================================
 @ Data Section (Constants)
@@ -15,8 +18,15 @@
 
 .section .data
     dev_mem_path:  .asciz "/dev/mem"
+    dev_uio_path:  .asciz "/dev/uio0" @ generic-uio node for pio_FLAGS (f2h_irq0 bit 0)
     FPGA_BRIDGE_BASE: .word 0xFF200000
     FPGA_BRIDGE_SPAN: .word 0x00001000 @ 4 KB
+    FPGA_VRAM_BASE:   .word 0xC0080000 @ H2F AXI bridge + vram_bridge.s0 (Qsys)
+    FPGA_VRAM_SPAN:   .word 0x00080000 @ 512 KB: mem1, back, front at 128 KB steps
+    DMA_POOL_BASE:    .word 0x3F000000 @ last 16 MB of DDR, kept out of Linux (mem=1008M)
+    DMA_POOL_SPAN:    .word 0x01000000 @ 16 MB
+    proc_iomem_path:  .asciz "/proc/iomem" @ physical memory map, checked before the DMA pool
+    iomem_ram_tag:    .asciz " : System RAM"
 
     @ --- HAVE TO FIX ADDRESSES --- DONE (CHECK QSYS LATER)
 
@@ -24,6 +34,12 @@
     .equ PIO_INSTR_OFS,    0x00
     .equ PIO_ENABLE,       0x10
     .equ PIO_FLAGS_OFS,    0x20
+    .equ PIO_FLAGS_IRQMASK_OFS, 0x28  @ interruptmask register of pio_FLAGS
+    .equ PIO_FLAGS_EDGECAP_OFS, 0x2C  @ edgecapture register (write 1 to clear)
+    .equ PIO_DATA_OFS,     0x30  @ 4 packed pixels for STORE + EXT_PACKED
+    .equ PIO_DATA_OUT_OFS, 0x40  @ pixel returned by LOAD (input PIO)
+    .equ PIO_PERF_SEL_OFS, 0x50  @ perf counter register select (output PIO)
+    .equ PIO_PERF_OFS,     0x60  @ selected perf counter register (input PIO)
 
     @ --- INSTRUCTIONS ---
     .equ INSTR_NOP,        0
@@ -35,6 +51,20 @@
     .equ INSTR_NH_ALG,     6
     .equ INSTR_RESET,      7
 
+    @ --- INSTRUCTION MODIFIERS (bits [31:29]) ---
+    .equ INSTR_EXT_SHIFT,  29
+    .equ EXT_PACKED,       1     @ STORE: writes pio_DATA bytes to addr..addr+3
+    .equ EXT_DMA,          2     @ STORE: FPGA reads addr bytes from phys pio_DATA
+    .equ EXT_SPANS,        3     @ STORE: same, but the bytes are a span list (dma_reader.v)
+    .equ EXT_RLE,          4     @ STORE: same, but the bytes are an RLE frame (dma_reader.v)
+    .equ EXT_VSYNC,        5     @ NOP: copy mem1 to the back display buffer, flip on vsync
+    .equ EXT_SCAN,         6     @ NHI/PR/NH: remap the VGA scan-out instead of computing
+    .equ EXT_CACHE,        1     @ NOP: zoom level cache on (address bit 0) or off, emptied either way
+    .equ EXT_LEVEL,        4     @ NOP: jump to a zoom level, address field = {scan, alg[1:0], level}
+    .equ EXT_CENTER,       6     @ NOP: set the zoom centre, address field = {y[7:0], x[8:0]}
+    .equ EXT_SCALE,        7     @ NOP: resample mem1 at the 8.8 factor in the address field
+    .equ EXT_BILINEAR,     7     @ NHI: bilinear zoom in instead of pixel replication
+
     @ ======================================================================
     @ BIT MASKS 
     @ =====================================================================
@@ -55,11 +85,19 @@
     .equ IMAGE_WIDTH,      320 @ pixels
     .equ IMAGE_HEIGHT,     240 @ pixels
     .equ IMAGE_SIZE,       76800 @ 76800 Bytes
+    .equ VRAM_MEM_SHIFT,   17    @ window offset of each memory: sel << 17
 
     @ --- SYNCHRONIZATION PARAMETERS ---
 
+    @ --- PERF COUNTERS (perf_counters.v) ---
+    .equ PERF_ID,          0x50455246 @ "PERF", read at select 0
+    .equ PERF_LAST_SEL,    24    @ selects 1..24 = PerfCounters words, in order
+    .equ PERF_CACHE_HITS,  23    @ zoom level cache hits (misses at 24)
+
     .equ TIMEOUT_LIMIT,    0x3500
+    .equ POLLIN,           1
     .equ DELAY_COUNT,      0x1000
+    .equ IOMEM_BUF_SIZE,   16384 @ /proc/iomem is read whole (a few hundred bytes on the DE1-SoC)
 
     @ --- STATUS CODES ---
 
@@ -71,6 +109,12 @@
 .section .bss
     .lcomm fd_mem, 4           @ File Descriptor for /dev/mem
     .lcomm lw_bridge_ptr, 4    @ virtual pointer for LW Bridge
+    .lcomm vram_ptr, 4         @ virtual pointer for the VRAM window (H2F bridge)
+    .lcomm dma_pool_ptr, 4     @ virtual pointer for the DMA pool (0 = not mapped)
+    .lcomm dma_pool_used, 4    @ bytes already handed out by API_Dma_Alloc
+    .lcomm fd_uio, 4           @ File Descriptor for /dev/uio0, plus 1 (0 = not open)
+    .lcomm alg_ext, 4          @ modifier ORed into the algorithm opcodes (API_Set_Scanout)
+    .lcomm iomem_buf, IOMEM_BUF_SIZE + 1 @ /proc/iomem text, NUL-terminated
 
 @ ===================================================================
 @ Text Section
@@ -97,6 +141,131 @@ _pulse_enable_safe:
     POP     {R2, R3, R4}
     BX      LR
     
+@ _iomem_hex: parses hex digits at R1
+@ Returns the value in R0 and R1 past the last digit (uses R2, R3)
+
+_iomem_hex:
+    MOV     R0, #0
+.HEX_LOOP:
+    LDRB    R2, [R1]
+    SUB     R3, R2, #'0'
+    CMP     R3, #9
+    BLS     .HEX_DIGIT
+    ORR     R3, R2, #0x20       @ lower case
+    SUB     R3, R3, #'a'
+    CMP     R3, #5
+    BXHI    LR
+    ADD     R3, R3, #10
+.HEX_DIGIT:
+    ORR     R0, R3, R0, LSL #4
+    ADD     R1, R1, #1
+    B       .HEX_LOOP
+
+@ _dma_pool_reserved: checks that Linux does not own the DMA pool
+@ Reads /proc/iomem and looks for a "System RAM" range that overlaps
+@ [DMA_POOL_BASE, DMA_POOL_BASE + DMA_POOL_SPAN). Returns 1 if there is
+@ none, 0 if there is one or the map cannot be trusted (file unreadable,
+@ too big, or all addresses zero, which is what non-root users see).
+
+_dma_pool_reserved:
+    PUSH    {R4-R9, LR}
+    LDR     R0, =proc_iomem_path
+    MOV     R1, #0              @ O_RDONLY
+    MOV     R7, #__NR_open
+    SVC     0
+    CMP     R0, #0
+    BLT     .IOMEM_NO
+    MOV     R4, R0              @ R4 = fd
+    MOV     R5, #0              @ R5 = bytes read
+
+.IOMEM_READ:
+    MOV     R0, R4
+    LDR     R1, =iomem_buf
+    ADD     R1, R1, R5
+    LDR     R2, =IOMEM_BUF_SIZE
+    SUB     R2, R2, R5
+    MOV     R7, #__NR_read
+    SVC     0
+    CMP     R0, #0
+    BLE     .IOMEM_CLOSE        @ 0 = end of file, < 0 = error
+    ADD     R5, R5, R0
+    LDR     R2, =IOMEM_BUF_SIZE
+    CMP     R5, R2
+    BLO     .IOMEM_READ
+    MVN     R0, #0              @ buffer full: the map did not fit
+
+.IOMEM_CLOSE:
+    MOV     R6, R0
+    MOV     R0, R4
+    MOV     R7, #__NR_close
+    SVC     0
+    CMP     R6, #0
+    BNE     .IOMEM_NO
+
+    LDR     R1, =iomem_buf
+    MOV     R0, #0
+    STRB    R0, [R1, R5]        @ NUL ends the scan
+    MOV     R4, #0              @ R4 = a System RAM range with real addresses was seen
+
+    @ each line: "<indent>start-end : name", addresses inclusive
+.IOMEM_LINE:
+    LDRB    R0, [R1]
+    CMP     R0, #' '
+    ADDEQ   R1, R1, #1
+    BEQ     .IOMEM_LINE
+    CMP     R0, #0
+    BEQ     .IOMEM_DONE
+    BL      _iomem_hex
+    MOV     R6, R0              @ R6 = start
+    LDRB    R0, [R1]
+    CMP     R0, #'-'
+    BNE     .IOMEM_NEXT
+    ADD     R1, R1, #1
+    BL      _iomem_hex
+    MOV     R9, R0              @ R9 = end
+
+    LDR     R2, =iomem_ram_tag
+.IOMEM_CMP:
+    LDRB    R3, [R2], #1
+    CMP     R3, #0
+    BEQ     .IOMEM_RAM
+    LDRB    R0, [R1], #1
+    CMP     R0, R3
+    BEQ     .IOMEM_CMP
+    SUB     R1, R1, #1          @ the mismatch may be the newline
+    B       .IOMEM_NEXT
+
+.IOMEM_RAM:
+    CMP     R9, #0
+    MOVNE   R4, #1
+    LDR     R2, =DMA_POOL_BASE
+    LDR     R2, [R2]
+    CMP     R9, R2
+    BLO     .IOMEM_NEXT         @ ends below the pool
+    LDR     R3, =DMA_POOL_SPAN
+    LDR     R3, [R3]
+    ADD     R3, R2, R3
+    SUB     R3, R3, #1
+    CMP     R6, R3
+    BLS     .IOMEM_NO           @ Linux RAM inside the pool
+
+.IOMEM_NEXT:
+    LDRB    R0, [R1]
+    CMP     R0, #0
+    BEQ     .IOMEM_DONE
+    ADD     R1, R1, #1
+    CMP     R0, #'\n'
+    BNE     .IOMEM_NEXT
+    B       .IOMEM_LINE
+
+.IOMEM_DONE:
+    MOV     R0, R4
+    POP     {R4-R9, PC}
+
+.IOMEM_NO:
+    MOV     R0, #0
+    POP     {R4-R9, PC}
+
 @ _ASM_Set_Instruction: Internal function
 @ ONLY sets the inSTRuction opcode in PIO_INSTR (no pulse or wait)
 @ R0 = opcode
@@ -176,6 +345,32 @@ API_initialize:
     
     LDR R1, =lw_bridge_ptr
     STR R0, [R1]
+    MOV R6, R0             @ keeps LW pointer for the return value
+
+    @ --- VRAM window (mem1) on the H2F AXI bridge ---
+    MOV R0, #0
+    LDR R1, =FPGA_VRAM_SPAN
+    LDR R1, [R1]
+    MOV R2, #3 @ PROT_READ | PROT_WRITE
+    MOV R3, #1 @ MAP_SHARED
+    LDR R4, =fd_mem
+    LDR R4, [R4]
+    LDR R5, =FPGA_VRAM_BASE
+    LDR R5, [R5]
+    LSR R5, R5, #12
+    MOV R7, #__NR_mmap2
+
+    SVC 0
+
+    @ the VRAM window is optional: if it cannot be mapped the LW bridge
+    @ still works, so keep vram_ptr = 0 (ASM_Upload_Frame and
+    @ API_Read_Frame then return -1) and report success
+    CMP R0, #0
+    MOVLT R0, #0
+
+    LDR R1, =vram_ptr
+    STR R0, [R1]
+    MOV R0, R6
     POP {R4-R11, PC}       @ RETURNS WITH POINTER IN R0
 
 open_fail:
@@ -183,6 +378,10 @@ open_fail:
     POP {R4-R11, PC}
 
 mmap_fail:
+    LDR R0, =fd_mem
+    LDR R0, [R0]
+    MOV R7, #__NR_close
+    SVC 0
     MOV R0, #-2             @ RETURNS (-2) ON MAP ERROR
     POP {R4-R11, PC}
 
@@ -202,7 +401,46 @@ API_close:
     LDR R1, [R1]
     MOV R7, #__NR_munmap
     SVC 0
-    
+
+    LDR R0, =vram_ptr
+    LDR R0, [R0]
+    CMP R0, #0
+    BEQ .CLOSE_DMA          @ window was never mapped
+    LDR R1, =FPGA_VRAM_SPAN
+    LDR R1, [R1]
+    MOV R7, #__NR_munmap
+    SVC 0
+    LDR R0, =vram_ptr
+    MOV R1, #0
+    STR R1, [R0]
+
+.CLOSE_DMA:
+    LDR R0, =dma_pool_ptr
+    LDR R0, [R0]
+    CMP R0, #0
+    BEQ .CLOSE_FD
+    LDR R1, =DMA_POOL_SPAN
+    LDR R1, [R1]
+    MOV R7, #__NR_munmap
+    SVC 0
+    LDR R0, =dma_pool_ptr
+    MOV R1, #0
+    STR R1, [R0]
+    LDR R0, =dma_pool_used
+    STR R1, [R0]
+
+.CLOSE_FD:
+    LDR R1, =fd_uio
+    LDR R0, [R1]
+    CMP R0, #0
+    BEQ .CLOSE_MEM
+    MOV R2, #0
+    STR R2, [R1]
+    SUB R0, R0, #1
+    MOV R7, #__NR_close
+    SVC 0
+
+.CLOSE_MEM:
     LDR R0, =fd_mem
     LDR R0, [R0]
     MOV R7, #__NR_close
@@ -224,7 +462,7 @@ ASM_Store:
     LDR     R4, =lw_bridge_ptr
     LDR     R4, [R4]
     CMP     R0, #IMAGE_SIZE
-    BHS     .INVALID_ADDRESS
+    BHS     .WR_INVALID_ADDRESS
 
 .ASM_WR_PACKET_CONSTRUCTION:
     @ Assembles the instruction packet
@@ -254,16 +492,16 @@ ASM_Store:
     @ polling for DONE flag
     LDR     R2, [R4, #PIO_FLAGS_OFS]
     TST     R2, #FLAG_DONE_MASK
-    BNE     .CHECK_ERROR
+    BNE     .WR_CHECK_ERROR
     SUBS    R5, R5, #1
-    BNE     .POLLING
-    MOV     R0, #0 @cl
+    BNE     .WR_POLLING
+    MOV     R0, #-2             @ timeout
     B       .EXIT
 
 .WR_CHECK_ERROR:
     @ check for ERROR flag
     TST     R2, #FLAG_ERROR_MASK
-    BNE     .HW_ERROR
+    BNE     .WR_HW_ERROR
     MOV     R0, #0
 
     MOV     R5, #DELAY_COUNT
@@ -285,60 +523,786 @@ ASM_Store:
     POP     {R4-R6, PC}
 .size ASM_Store, .-ASM_Store
 
-@.global ASM_Load
-@.type ASM_Load, %function
-
-@ASM_Load:
-@    PUSH    {R4-R6, LR}
-@    LDR     R4, =FPGA_ADRS
-@    LDR     R4, [R4]
-@    CMP     R0, #IMAGE_SIZE
-@    BHS     .RD_INVALID_ADDRESS
-
-@.ASM_RD_PACKET_CONSTRUCTION:
-
-@    MOV     R2, #INSTR_LOAD
-@    LSL     R3, R0, #3
-@    ORR     R2, R2, R3
-@    MOV     R3, R1
-@    LSL     R3, R3, #20
-@    ORR     R2, R2, R3
-@    STR     R2, [R4, #PIO_INSTR_OFS]
-
-@    DMB     sy
-
-@    MOV     R2, #1
-@    STR     R2, [R4, #PIO_ENABLE]
-@    MOV     R2, #0
-@    STR     R2, [R4, #PIO_ENABLE]
-
-@    MOV     R5, #TIMEOUT_COUNT
-
-@.RD_POLLING:
-@    LDR     R2, [R4, #PIO_FLAGS]
-@    TST     R2, #FLAG_DONE_MASK
-@    BNE     .CHECK_ERROR_RD
-@    SUBS    R5, R5, #1
-@    BNE     .WAIT_LOOP_RD
-@    MOV     R0, #0
-@    B       .EXIT_RD
-
-@.RD_CHECK_ERROR:
-@    TST     R2, #FLAG_ERROR_MASK
-@    BNE     .HW_ERROR_RD
-@    LDR     R0, [R4, #PIO]
-@    B       .EXIT_RD
-
-@.INVALID_ADDRESS_RD:
-@    MOV     R0, #-1
-@    B       .EXIT_RD
-
-@.RD_HW_ERROR:
-@    MOV     R0, #-3
-
-@.RD_EXIT:
-@    POP     {R4-R6, PC}
-@.size ASM_Load, .-ASM_Load
+@ --- ASM_Store_Packed (R0=address, R1=pixels) ---
+@ BLOCKING FUNCTION - !
+@ Writes 4 consecutive pixels with a single ENABLE pulse:
+@ pixels[7:0] -> address, [15:8] -> address+1, ... [31:24] -> address+3
+@ Returns 0 (success), -1 (invalid address), -2 (timeout), -3 (hw error)
+
+.global ASM_Store_Packed
+.type ASM_Store_Packed, %function
+
+ASM_Store_Packed:
+    PUSH    {R4-R6, LR}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    MOV     R3, #IMAGE_SIZE
+    SUB     R3, R3, #3          @ last valid base address + 1
+    CMP     R0, R3
+    BHS     .PK_INVALID_ADDRESS
+
+    STR     R1, [R4, #PIO_DATA_OFS]
+    LDR     R2, =(INSTR_STORE | (1 << 20) | (EXT_PACKED << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R0, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+    @ read-back, as in ASM_Load: no stale DONE from the previous command
+    LDR     R2, [R4, #PIO_ENABLE]
+
+    MOV     R5, #TIMEOUT_LIMIT
+
+.PK_POLLING:
+    LDR     R2, [R4, #PIO_FLAGS_OFS]
+    TST     R2, #FLAG_DONE_MASK
+    BNE     .PK_CHECK_ERROR
+    SUBS    R5, R5, #1
+    BNE     .PK_POLLING
+    MOV     R0, #-2
+    B       .PK_EXIT
+
+.PK_CHECK_ERROR:
+    TST     R2, #FLAG_ERROR_MASK
+    MOV     R0, #0
+    MOVNE   R0, #-3
+    B       .PK_EXIT
+
+.PK_INVALID_ADDRESS:
+    MOV     R0, #-1
+
+.PK_EXIT:
+    POP     {R4-R6, PC}
+.size ASM_Store_Packed, .-ASM_Store_Packed
+
+@ --- ASM_Store_Block (R0=start_addr, R1=buf, R2=n) ---
+@ BLOCKING FUNCTION - !
+@ Streams n pixels from buf into VRAM, starting at start_addr.
+@ Groups of 4 pixels go as one packed STORE (pio_DATA + EXT_PACKED), the
+@ remaining 0-3 pixels as plain STOREs. The ENABLE pulse is inlined and
+@ there is no DELAY_COUNT: a PIO_ENABLE read-back (as in ASM_Load) orders
+@ the pulse before the FLAGS polling, then each packet waits for FLAG_DONE.
+@ Returns 0 (success), -1 (range out of VRAM), -2 (timeout), -3 (hw error)
+
+.global ASM_Store_Block
+.type ASM_Store_Block, %function
+
+ASM_Store_Block:
+    PUSH    {R4-R9, LR}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+
+    @ range check: start_addr < IMAGE_SIZE and n <= IMAGE_SIZE - start_addr
+    CMP     R0, #IMAGE_SIZE
+    BHS     .BLK_INVALID_ADDRESS
+    MOV     R3, #IMAGE_SIZE
+    SUB     R3, R3, R0
+    CMP     R2, R3
+    BHI     .BLK_INVALID_ADDRESS
+
+    MOV     R5, R0              @ R5 = current VRAM address
+    ADD     R6, R1, R2          @ R6 = end of source buffer
+    LDR     R8, =(INSTR_STORE | (1 << 20))  @ opcode + selection memory bit
+    LDR     R9, =(INSTR_STORE | (1 << 20) | (EXT_PACKED << INSTR_EXT_SHIFT))
+
+.BLK_LOOP:
+    SUB     R3, R6, R1          @ pixels left
+    CMP     R3, #4
+    BLO     .BLK_SINGLE
+
+    @ 4 pixels -> pio_DATA (byte loads: buf has no alignment requirement)
+    LDRB    R2, [R1], #1
+    LDRB    R3, [R1], #1
+    ORR     R2, R2, R3, LSL #8
+    LDRB    R3, [R1], #1
+    ORR     R2, R2, R3, LSL #16
+    LDRB    R3, [R1], #1
+    ORR     R2, R2, R3, LSL #24
+    STR     R2, [R4, #PIO_DATA_OFS]
+
+    @ packet: opcode | address << 3 | sel_mem | EXT_PACKED << 29
+    ORR     R2, R9, R5, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    ADD     R5, R5, #4
+    B       .BLK_SEND
+
+.BLK_SINGLE:
+    CMP     R1, R6
+    BHS     .BLK_DONE
+
+    @ packet: opcode | address << 3 | sel_mem | pixel << 21
+    LDRB    R3, [R1], #1
+    ORR     R2, R8, R5, LSL #3
+    ORR     R2, R2, R3, LSL #21
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    ADD     R5, R5, #1
+
+.BLK_SEND:
+    DMB     sy
+
+    @ inlined _pulse_enable_safe
+    MOV     R3, #1
+    STR     R3, [R4, #PIO_ENABLE]
+    MOV     R3, #0
+    STR     R3, [R4, #PIO_ENABLE]
+    @ read-back: DONE stays 1 in IDLE, so without it the first FLAGS read
+    @ can return before the FSM saw the pulse and the next packet would
+    @ land while this one is still in READ_AND_WRITE
+    LDR     R3, [R4, #PIO_ENABLE]
+
+    MOV     R7, #TIMEOUT_LIMIT
+
+.BLK_POLLING:
+    @ the STORE path takes a few FPGA cycles, far less than one bridge read
+    LDR     R3, [R4, #PIO_FLAGS_OFS]
+    TST     R3, #FLAG_DONE_MASK
+    BNE     .BLK_CHECK_ERROR
+    SUBS    R7, R7, #1
+    BNE     .BLK_POLLING
+    MOV     R0, #-2
+    B       .BLK_EXIT
+
+.BLK_CHECK_ERROR:
+    TST     R3, #FLAG_ERROR_MASK
+    BEQ     .BLK_LOOP
+    MOV     R0, #-3
+    B       .BLK_EXIT
+
+.BLK_DONE:
+    MOV     R0, #0
+    B       .BLK_EXIT
+
+.BLK_INVALID_ADDRESS:
+    MOV     R0, #-1
+
+.BLK_EXIT:
+    POP     {R4-R9, PC}
+.size ASM_Store_Block, .-ASM_Store_Block
+
+@ --- ASM_Upload_Frame (R0=buf) ---
+@ BLOCKING FUNCTION - !
+@ Copies a whole frame (IMAGE_SIZE bytes) into mem1 through the VRAM window,
+@ 32 bytes per LDM/STM burst. No per-pixel protocol is involved: the
+@ vram_bridge is 32 bits wide, so every word is a single 4-pixel write.
+@ buf must be 4-byte aligned. Like ASM_Store_Block, it does not refresh the
+@ display: call ASM_Refresh afterwards.
+@ Returns 0 (success) or -1 (window not mapped / unaligned buffer)
+
+.global ASM_Upload_Frame
+.type ASM_Upload_Frame, %function
+
+ASM_Upload_Frame:
+    PUSH    {R4-R11, LR}
+    LDR     R1, =vram_ptr
+    LDR     R1, [R1]
+    CMP     R1, #0
+    BEQ     .UP_FAIL
+    TST     R0, #3
+    BNE     .UP_FAIL
+
+    MOV     R2, #IMAGE_SIZE     @ 76800 = 2400 bursts of 32 bytes
+
+.UP_LOOP:
+    LDMIA   R0!, {R3-R10}
+    STMIA   R1!, {R3-R10}
+    SUBS    R2, R2, #32
+    BNE     .UP_LOOP
+
+    @ reading back from the window drains the posted writes on the H2F
+    @ bridge, so a following command on the LW bridge sees the whole frame
+    LDRB    R3, [R1, #-1]
+    DSB     sy
+
+    MOV     R0, #0
+    POP     {R4-R11, PC}
+
+.UP_FAIL:
+    MOV     R0, #-1
+    POP     {R4-R11, PC}
+.size ASM_Upload_Frame, .-ASM_Upload_Frame
+
+@ --- API_Get_VRAM (void) ---
+@ Returns the virtual pointer of the VRAM window (NULL before API_initialize)
+
+.global API_Get_VRAM
+.type API_Get_VRAM, %function
+
+API_Get_VRAM:
+    LDR     R0, =vram_ptr
+    LDR     R0, [R0]
+    BX      LR
+.size API_Get_VRAM, .-API_Get_VRAM
+
+@ --- API_Dma_Alloc (R0=size, R1=phys_out) ---
+@ Hands out a physically contiguous buffer from the DMA pool (a DDR region
+@ reserved from Linux and mapped through /dev/mem, so it is not cached and
+@ the FPGA reads exactly what the CPU wrote). Sizes are rounded up to 4 KB.
+@ Requires API_initialize (uses fd_mem). The pool is mapped on first use,
+@ and only if /proc/iomem shows no System RAM over it: on a kernel that
+@ was not booted with the region reserved (mem=1008M or a no-map
+@ reserved-memory node) those pages belong to Linux and must not be
+@ touched. Returns the virtual pointer and stores the physical address in
+@ *phys_out, or returns NULL (0) if the region is not reserved, the pool
+@ is exhausted or it cannot be mapped.
+
+.global API_Dma_Alloc
+.type API_Dma_Alloc, %function
+
+API_Dma_Alloc:
+    PUSH    {R4-R9, LR}
+    MOV     R8, R0              @ R8 = size
+    MOV     R9, R1              @ R9 = phys_out
+
+    LDR     R6, =dma_pool_ptr
+    LDR     R0, [R6]
+    CMP     R0, #0
+    BNE     .DMA_ALLOC
+
+    @ first call: map the whole pool, if Linux left it alone
+    BL      _dma_pool_reserved
+    CMP     R0, #0
+    BEQ     .DMA_FAIL
+    MOV     R0, #0
+    LDR     R1, =DMA_POOL_SPAN
+    LDR     R1, [R1]
+    MOV     R2, #3 @ PROT_READ | PROT_WRITE
+    MOV     R3, #1 @ MAP_SHARED
+    LDR     R4, =fd_mem
+    LDR     R4, [R4]
+    LDR     R5, =DMA_POOL_BASE
+    LDR     R5, [R5]
+    LSR     R5, R5, #12
+    MOV     R7, #__NR_mmap2
+
+    SVC     0
+
+    CMP     R0, #0
+    BLT     .DMA_FAIL
+    STR     R0, [R6]
+
+.DMA_ALLOC:
+    @ R2 = size rounded up to 4 KB
+    LDR     R3, =0xFFF
+    ADD     R2, R8, R3
+    BIC     R2, R2, R3
+
+    LDR     R4, =dma_pool_used
+    LDR     R5, [R4]            @ R5 = offset of the new buffer
+    ADD     R3, R5, R2          @ R3 = new used size
+    LDR     R1, =DMA_POOL_SPAN
+    LDR     R1, [R1]
+    CMP     R3, R1
+    BHI     .DMA_FAIL
+    STR     R3, [R4]
+
+    CMP     R9, #0
+    LDRNE   R1, =DMA_POOL_BASE
+    LDRNE   R1, [R1]
+    ADDNE   R1, R1, R5
+    STRNE   R1, [R9]
+
+    ADD     R0, R0, R5
+    POP     {R4-R9, PC}
+
+.DMA_FAIL:
+    MOV     R0, #0
+    POP     {R4-R9, PC}
+.size API_Dma_Alloc, .-API_Dma_Alloc
+
+@ --- API_Dma_Free_All (void) ---
+@ Gives every DMA buffer back to the pool (the mapping is kept)
+
+.global API_Dma_Free_All
+.type API_Dma_Free_All, %function
+
+API_Dma_Free_All:
+    LDR     R0, =dma_pool_used
+    MOV     R1, #0
+    STR     R1, [R0]
+    BX      LR
+.size API_Dma_Free_All, .-API_Dma_Free_All
+
+@ --- ASM_Dma_Upload (R0=phys_addr, R1=n) ---
+@ NON-BLOCKING: rings the DMA doorbell and returns at once.
+@ The FPGA reads n bytes from phys_addr into mem1 (from address 0) and
+@ raises FLAG_DONE at the end; the CPU is free meanwhile.
+@ phys_addr must be 32-byte aligned (API_Dma_Alloc gives 4 KB alignment).
+@ Returns 0 (started) or -1 (n > IMAGE_SIZE or unaligned address)
+
+.global ASM_Dma_Upload
+.type ASM_Dma_Upload, %function
+
+ASM_Dma_Upload:
+    PUSH    {R4, LR}
+    TST     R0, #31
+    BNE     .DMA_UP_INVALID
+    CMP     R1, #IMAGE_SIZE
+    BHI     .DMA_UP_INVALID
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    STR     R0, [R4, #PIO_DATA_OFS]
+    LDR     R2, =(INSTR_STORE | (EXT_DMA << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R1, LSL #3  @ length goes in the address field
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.DMA_UP_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size ASM_Dma_Upload, .-ASM_Dma_Upload
+
+@ --- ASM_Dma_Upload_Spans (R0=phys_addr, R1=n) ---
+@ NON-BLOCKING: like ASM_Dma_Upload, but the n bytes at phys_addr are a
+@ span list: each span is a header word (mem1 address in [16:0], pixel
+@ count in [31:17]) followed by its pixels, padded to a whole word.
+@ Returns 0 (started) or -1 (n not a multiple of 4, n > 0x1FFFF or unaligned address)
+
+.global ASM_Dma_Upload_Spans
+.type ASM_Dma_Upload_Spans, %function
+
+ASM_Dma_Upload_Spans:
+    PUSH    {R4, LR}
+    TST     R0, #31
+    BNE     .SPANS_INVALID
+    TST     R1, #3
+    BNE     .SPANS_INVALID
+    LDR     R2, =0x1FFFF        @ the length must fit the address field
+    CMP     R1, R2
+    BHI     .SPANS_INVALID
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    STR     R0, [R4, #PIO_DATA_OFS]
+    LDR     R2, =(INSTR_STORE | (EXT_SPANS << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R1, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.SPANS_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size ASM_Dma_Upload_Spans, .-ASM_Dma_Upload_Spans
+
+@ --- ASM_Dma_Upload_Rle (R0=phys_addr, R1=n) ---
+@ NON-BLOCKING: like ASM_Dma_Upload, but the n bytes at phys_addr are an
+@ RLE frame, expanded by the FPGA into mem1 from address 0 at one pixel
+@ per clock. Control byte c < 128: c+1 literal pixels follow;
+@ c >= 128: the next byte is repeated c-126 times.
+@ Returns 0 (started) or -1 (n > 0x1FFFF or unaligned address)
+
+.global ASM_Dma_Upload_Rle
+.type ASM_Dma_Upload_Rle, %function
+
+ASM_Dma_Upload_Rle:
+    PUSH    {R4, LR}
+    TST     R0, #31
+    BNE     .RLE_INVALID
+    LDR     R2, =0x1FFFF        @ the length must fit the address field
+    CMP     R1, R2
+    BHI     .RLE_INVALID
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    STR     R0, [R4, #PIO_DATA_OFS]
+    LDR     R2, =(INSTR_STORE | (EXT_RLE << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R1, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.RLE_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size ASM_Dma_Upload_Rle, .-ASM_Dma_Upload_Rle
+
+@ ===================================================================
+@ COMPLETION INTERRUPT (pio_FLAGS -> f2h_irq0 -> /dev/uio0)
+@ pio_FLAGS captures rising edges of FLAG_DONE and FLAG_ERROR and raises
+@ its IRQ while a captured edge is unmasked. The kernel needs a
+@ generic-uio node for it, e.g. in the device tree:
+@   reg = <0xff200020 0x10>; interrupts = <0 40 4>;
+@ and bootargs uio_pdrv_genirq.of_id=generic-uio
+@ ===================================================================
+
+@ --- API_Get_Irq_Fd (void) ---
+@ Opens /dev/uio0 on first use and unmasks DONE/ERROR in pio_FLAGS.
+@ Returns the file descriptor (pollable with POLLIN) or -1 if there is no
+@ UIO device.
+
+.global API_Get_Irq_Fd
+.type API_Get_Irq_Fd, %function
+
+API_Get_Irq_Fd:
+    PUSH    {R4, R7}
+    LDR     R4, =fd_uio
+    LDR     R0, [R4]
+    CMP     R0, #0
+    SUBNE   R0, R0, #1
+    BNE     .IRQ_FD_EXIT
+
+    LDR     R0, =dev_uio_path
+    MOV     R1, #2 @ O_RDWR
+    MOV     R7, #__NR_open
+    SVC     0
+    CMP     R0, #0
+    MOVLT   R0, #-1
+    BLT     .IRQ_FD_EXIT
+
+    ADD     R1, R0, #1
+    STR     R1, [R4]
+
+    LDR     R1, =lw_bridge_ptr
+    LDR     R1, [R1]
+    MOV     R2, #(FLAG_DONE_MASK | FLAG_ERROR_MASK)
+    STR     R2, [R1, #PIO_FLAGS_IRQMASK_OFS]
+
+.IRQ_FD_EXIT:
+    POP     {R4, R7}
+    BX      LR
+.size API_Get_Irq_Fd, .-API_Get_Irq_Fd
+
+@ --- API_Irq_Rearm (void) ---
+@ Clears the captured edges in pio_FLAGS and re-enables the UIO interrupt
+@ (UIO masks it after each delivery). Call it after reading the fd and
+@ before polling it again.
+@ Returns 0 or -1 if there is no UIO device.
+
+.global API_Irq_Rearm
+.type API_Irq_Rearm, %function
+
+API_Irq_Rearm:
+    PUSH    {R4, R7, LR}
+    SUB     SP, SP, #8
+    BL      API_Get_Irq_Fd
+    CMP     R0, #0
+    BLT     .REARM_EXIT
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    MOV     R2, #(FLAG_DONE_MASK | FLAG_ERROR_MASK)
+    STR     R2, [R4, #PIO_FLAGS_EDGECAP_OFS]
+    DMB     sy
+
+    @ write(fd, &1, 4): irq on again
+    MOV     R2, #1
+    STR     R2, [SP]
+    MOV     R1, SP
+    MOV     R2, #4
+    MOV     R7, #__NR_write
+    SVC     0
+    MOV     R0, #0
+
+.REARM_EXIT:
+    ADD     SP, SP, #8
+    POP     {R4, R7, PC}
+.size API_Irq_Rearm, .-API_Irq_Rearm
+
+@ --- API_Wait_Done (R0=timeout_us) ---
+@ BLOCKING FUNCTION - sleeps in ppoll() on /dev/uio0, no spinning.
+@ Returns as soon as FLAG_DONE is high. The edges are cleared before the
+@ level is read, so a completion between the read and the sleep still
+@ raises the IRQ. The timeout applies to each sleep.
+@ FLAG_ERROR is sticky until RESET, so it is only looked at once DONE is
+@ back: a command still running is never reported as failed.
+@ Returns 0 (done), -1 (no UIO device), -2 (timeout), -3 (FLAG_ERROR)
+
+.global API_Wait_Done
+.type API_Wait_Done, %function
+
+API_Wait_Done:
+    PUSH    {R4-R8, LR}
+    SUB     SP, SP, #16         @ [SP] struct pollfd, [SP+8] struct timespec
+    MOV     R8, R0              @ R8 = timeout_us
+
+    BL      API_Get_Irq_Fd
+    CMP     R0, #0
+    BLT     .WAIT_NO_IRQ
+    MOV     R6, R0              @ R6 = fd
+    LDR     R5, =lw_bridge_ptr
+    LDR     R5, [R5]
+    @ read-back, as in ASM_Load: the last ENABLE pulse is at the PIO before
+    @ FLAGS is read, so the DONE of the previous command is not seen
+    LDR     R2, [R5, #PIO_ENABLE]
+
+.WAIT_LOOP:
+    BL      API_Irq_Rearm
+
+    LDR     R2, [R5, #PIO_FLAGS_OFS]
+    TST     R2, #FLAG_DONE_MASK
+    BNE     .WAIT_DONE
+
+    @ pollfd = { fd, events = POLLIN, revents = 0 }
+    STR     R6, [SP]
+    MOV     R2, #POLLIN
+    STR     R2, [SP, #4]
+
+    @ timespec = { us / 1000000, (us % 1000000) * 1000 }
+    @ (no UDIV on the A9: multiply by 2^50 / 10^6 and keep the high word)
+    LDR     R3, =0x431BDE83
+    UMULL   R2, R3, R8, R3
+    LSR     R3, R3, #18
+    LDR     R2, =1000000
+    MUL     R1, R3, R2
+    SUB     R1, R8, R1
+    MOV     R2, #1000
+    MUL     R0, R1, R2
+    STR     R3, [SP, #8]
+    STR     R0, [SP, #12]
+
+    @ ppoll(fds, 1, &timeout, NULL, 8)
+    MOV     R0, SP
+    MOV     R1, #1
+    ADD     R2, SP, #8
+    MOV     R3, #0
+    MOV     R4, #8
+    MOV     R7, #__NR_ppoll
+    SVC     0
+    CMP     R0, #0
+    BEQ     .WAIT_TIMEOUT
+    BLT     .WAIT_NO_IRQ
+
+    @ read(fd, &count, 4) acknowledges the interrupt
+    MOV     R0, R6
+    MOV     R1, SP
+    MOV     R2, #4
+    MOV     R7, #__NR_read
+    SVC     0
+    B       .WAIT_LOOP
+
+.WAIT_DONE:
+    TST     R2, #FLAG_ERROR_MASK
+    BNE     .WAIT_HW_ERROR
+    MOV     R0, #0
+    B       .WAIT_EXIT
+
+.WAIT_NO_IRQ:
+    MOV     R0, #-1
+    B       .WAIT_EXIT
+
+.WAIT_TIMEOUT:
+    MOV     R0, #-2
+    B       .WAIT_EXIT
+
+.WAIT_HW_ERROR:
+    MOV     R0, #-3
+
+.WAIT_EXIT:
+    ADD     SP, SP, #16
+    POP     {R4-R8, PC}
+.size API_Wait_Done, .-API_Wait_Done
+
+@ --- ASM_Load (R0=address, R1=sel_mem) ---
+@ BLOCKING FUNCTION - !
+@ Reads one pixel back: sel_mem 0 = mem1 (original), 1 = back display buffer
+@ Returns the pixel (0..255), -1 (invalid address), -2 (timeout), -3 (hw error)
+
+.global ASM_Load
+.type ASM_Load, %function
+
+ASM_Load:
+    PUSH    {R4-R6, LR}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    CMP     R0, #IMAGE_SIZE
+    BHS     .RD_INVALID_ADDRESS
+
+.ASM_RD_PACKET_CONSTRUCTION:
+    @ OPCODE
+    MOV     R2, #INSTR_LOAD
+    @ ADDRESS
+    LSL     R3, R0, #3
+    ORR     R2, R2, R3
+    @ SELECTION MEMORY BIT
+    AND     R3, R1, #1
+    LSL     R3, R3, #20
+    ORR     R2, R2, R3
+
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+    @ read-back: the ENABLE falling edge has reached the PIO before the
+    @ first FLAGS read, so a stale DONE from the previous command is not seen
+    LDR     R2, [R4, #PIO_ENABLE]
+
+    MOV     R5, #TIMEOUT_LIMIT
+
+.RD_POLLING:
+    LDR     R2, [R4, #PIO_FLAGS_OFS]
+    TST     R2, #FLAG_DONE_MASK
+    BNE     .RD_CHECK_ERROR
+    SUBS    R5, R5, #1
+    BNE     .RD_POLLING
+    MOV     R0, #-2             @ timeout
+    B       .RD_EXIT
+
+.RD_CHECK_ERROR:
+    TST     R2, #FLAG_ERROR_MASK
+    BNE     .RD_HW_ERROR
+    LDR     R0, [R4, #PIO_DATA_OUT_OFS]
+    AND     R0, R0, #0xFF
+    B       .RD_EXIT
+
+.RD_INVALID_ADDRESS:
+    MOV     R0, #-1
+    B       .RD_EXIT
+
+.RD_HW_ERROR:
+    MOV     R0, #-3
+
+.RD_EXIT:
+    POP     {R4-R6, PC}
+.size ASM_Load, .-ASM_Load
+
+@ --- API_Read_Frame (R0=which_mem, R1=buf) ---
+@ BLOCKING FUNCTION - !
+@ Copies a whole buffer (IMAGE_SIZE bytes) out of the FPGA through the VRAM
+@ window, 32 bytes per LDM/STM burst: which_mem 0 = mem1, 1 = back buffer,
+@ 2 = front buffer (mem2/mem3 swap roles on every flip). The FPGA stalls
+@ the reads (waitrequest) while the FSM is busy with mem1 or the back
+@ buffer, and the front buffer is only read during the VGA blanking.
+@ buf must be 4-byte aligned.
+@ Returns 0 (success) or -1 (window not mapped / bad memory / unaligned buffer)
+
+.global API_Read_Frame
+.type API_Read_Frame, %function
+
+API_Read_Frame:
+    PUSH    {R4-R11, LR}
+    LDR     R2, =vram_ptr
+    LDR     R2, [R2]
+    CMP     R2, #0
+    BEQ     .RF_FAIL
+    CMP     R0, #2
+    BHI     .RF_FAIL
+    TST     R1, #3
+    BNE     .RF_FAIL
+
+    ADD     R0, R2, R0, LSL #VRAM_MEM_SHIFT
+    MOV     R2, #IMAGE_SIZE     @ 76800 = 2400 bursts of 32 bytes
+
+.RF_LOOP:
+    LDMIA   R0!, {R3-R10}
+    STMIA   R1!, {R3-R10}
+    SUBS    R2, R2, #32
+    BNE     .RF_LOOP
+
+    MOV     R0, #0
+    POP     {R4-R11, PC}
+
+.RF_FAIL:
+    MOV     R0, #-1
+    POP     {R4-R11, PC}
+.size API_Read_Frame, .-API_Read_Frame
+
+@ --- API_Read_Perf_Counters (R0=PerfCounters *out) ---
+@ Select 0 makes the FPGA track the counters in a snapshot; moving to any
+@ other select freezes it, so the 24 words read afterwards are coherent.
+@ Each select is read back before the data, so the new value has reached
+@ the FPGA (and its 2-flop synchronizer) before PERF is sampled.
+@ Returns 0 (success) or -1 (not initialized / no perf block in the FPGA)
+
+.global API_Read_Perf_Counters
+.type API_Read_Perf_Counters, %function
+
+API_Read_Perf_Counters:
+    PUSH    {R4, LR}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    CMP     R4, #0
+    BEQ     .PERF_FAIL
+    CMP     R0, #0
+    BEQ     .PERF_FAIL
+
+    MOV     R1, #0
+    STR     R1, [R4, #PIO_PERF_SEL_OFS]
+    DMB     sy
+    LDR     R2, [R4, #PIO_PERF_SEL_OFS]
+    LDR     R2, [R4, #PIO_PERF_OFS]
+    LDR     R3, =PERF_ID
+    CMP     R2, R3
+    BNE     .PERF_FAIL
+
+    MOV     R1, #1
+.PERF_LOOP:
+    STR     R1, [R4, #PIO_PERF_SEL_OFS]
+    DMB     sy
+    LDR     R2, [R4, #PIO_PERF_SEL_OFS]
+    LDR     R2, [R4, #PIO_PERF_OFS]
+    STR     R2, [R0], #4        @ lo word first: matches uint64_t little-endian
+    ADD     R1, R1, #1
+    CMP     R1, #PERF_LAST_SEL + 1
+    BNE     .PERF_LOOP
+
+    MOV     R1, #0              @ back to select 0: snapshot follows the counters
+    STR     R1, [R4, #PIO_PERF_SEL_OFS]
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.PERF_FAIL:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size API_Read_Perf_Counters, .-API_Read_Perf_Counters
+
+@ --- API_Get_Zoom_Cache_Stats (R0=uint32_t *hits, R1=uint32_t *misses) ---
+@ Same snapshot protocol as API_Read_Perf_Counters, for selects 23 and 24 only.
+@ Returns 0 (success) or -1 (not initialized / no perf block in the FPGA)
+
+.global API_Get_Zoom_Cache_Stats
+.type API_Get_Zoom_Cache_Stats, %function
+
+API_Get_Zoom_Cache_Stats:
+    PUSH    {R4-R5, LR}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    CMP     R4, #0
+    BEQ     .CACHE_STATS_FAIL
+    CMP     R0, #0
+    CMPNE   R1, #0
+    BEQ     .CACHE_STATS_FAIL
+
+    MOV     R5, #0
+    STR     R5, [R4, #PIO_PERF_SEL_OFS]
+    DMB     sy
+    LDR     R2, [R4, #PIO_PERF_SEL_OFS]
+    LDR     R2, [R4, #PIO_PERF_OFS]
+    LDR     R3, =PERF_ID
+    CMP     R2, R3
+    BNE     .CACHE_STATS_FAIL
+
+    MOV     R5, #PERF_CACHE_HITS
+    STR     R5, [R4, #PIO_PERF_SEL_OFS]
+    DMB     sy
+    LDR     R2, [R4, #PIO_PERF_SEL_OFS]
+    LDR     R2, [R4, #PIO_PERF_OFS]
+    STR     R2, [R0]
+
+    ADD     R5, R5, #1
+    STR     R5, [R4, #PIO_PERF_SEL_OFS]
+    DMB     sy
+    LDR     R2, [R4, #PIO_PERF_SEL_OFS]
+    LDR     R2, [R4, #PIO_PERF_OFS]
+    STR     R2, [R1]
+
+    MOV     R5, #0              @ back to select 0: snapshot follows the counters
+    STR     R5, [R4, #PIO_PERF_SEL_OFS]
+    MOV     R0, #0
+    POP     {R4-R5, PC}
+
+.CACHE_STATS_FAIL:
+    MOV     R0, #-1
+    POP     {R4-R5, PC}
+.size API_Get_Zoom_Cache_Stats, .-API_Get_Zoom_Cache_Stats
 
 @ --- ASM_Refresh (void) ---
 @ Sends NOP instruction to refresh internal state
@@ -359,6 +1323,27 @@ ASM_Refresh:
     POP     {R2, R4, PC}
 .size ASM_Refresh, .-ASM_Refresh
 
+@ --- ASM_Refresh_Vsync (void) ---
+@ NON-BLOCKING: the FPGA copies mem1 into the display buffer that is not
+@ on screen and raises FLAG_DONE; the buffers swap at the next vsync.
+@ If the previous swap is still pending, the FPGA waits for it first.
+
+.global ASM_Refresh_Vsync
+.type ASM_Refresh_Vsync, %function
+ASM_Refresh_Vsync:
+    PUSH    {R2, R4, LR}
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+
+    LDR     R2, =(INSTR_NOP | (EXT_VSYNC << INSTR_EXT_SHIFT))
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    POP     {R2, R4, PC}
+.size ASM_Refresh_Vsync, .-ASM_Refresh_Vsync
+
 @ --- ASM_Pulse_Enable (void) --- 
 @ Pulse ENABLE bit
 
@@ -376,6 +1361,156 @@ ASM_Pulse_Enable:
 @ ONLY DEFINE THE INSTRUCTIONS - PULSE THE ENABLE WITH ASM_Pulse_Enable TO RUN
 @ ===================================================================
 
+@ _ASM_Set_Alg_Instruction: Internal function
+@ Like _ASM_Set_Instruction, with the API_Set_Scanout modifier ORed in
+@ R0 = opcode
+
+_ASM_Set_Alg_Instruction:
+    PUSH {R1, LR}
+    LDR R1, =alg_ext
+    LDR R1, [R1]
+    ORR R0, R0, R1
+    BL _ASM_Set_Instruction
+    POP {R1, PC}
+
+@ --- API_Set_Scanout (R0=enable) ---
+@ enable != 0: the algorithms below go out with EXT_SCAN, so NHI/PR/NH
+@ only change the VGA scan-out remap (no frame is computed)
+
+.global API_Set_Scanout
+.type API_Set_Scanout, %function
+
+API_Set_Scanout:
+    LDR R1, =alg_ext
+    CMP R0, #0
+    MOVNE R0, #(EXT_SCAN << INSTR_EXT_SHIFT)
+    STR R0, [R1]
+    BX LR
+.size API_Set_Scanout, .-API_Set_Scanout
+
+@ --- API_Zoom_To (R0=scale_q8) ---
+@ NON-BLOCKING: the FPGA resamples mem1 at scale_q8 / 256 (around the zoom centre) into
+@ the back display buffer and flips at the end (zoom_scale_stream.v).
+@ Returns 0 (started) or -1 (scale_q8 outside 0x20..0x800)
+
+.global API_Zoom_To
+.type API_Zoom_To, %function
+
+API_Zoom_To:
+    PUSH    {R4, LR}
+    CMP     R0, #0x20
+    BLO     .ZOOM_TO_INVALID
+    CMP     R0, #0x800
+    BHI     .ZOOM_TO_INVALID
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    LDR     R2, =(INSTR_NOP | (EXT_SCALE << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R0, LSL #3  @ factor goes in the address field
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.ZOOM_TO_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size API_Zoom_To, .-API_Zoom_To
+
+@ --- API_Set_Zoom (R0=level, R1=alg) ---
+@ NON-BLOCKING: the FPGA computes the level straight from mem1 in one
+@ pass (a plain copy at 1x) and flips at the end. The API_Set_Scanout
+@ modifier goes in bit 5 of the address field.
+@ Returns 0 (started) or -1 (level outside 1..7 or alg > 2)
+
+.global API_Set_Zoom
+.type API_Set_Zoom, %function
+
+API_Set_Zoom:
+    PUSH    {R4, LR}
+    SUB     R2, R0, #1
+    CMP     R2, #6              @ level - 1 in 0..6 (unsigned)
+    BHI     .SET_ZOOM_INVALID
+    CMP     R1, #2
+    BHI     .SET_ZOOM_INVALID
+
+    ORR     R0, R0, R1, LSL #3  @ {alg, level}
+    LDR     R2, =alg_ext
+    LDR     R2, [R2]
+    CMP     R2, #0
+    ORRNE   R0, R0, #(1 << 5)   @ EXT_SCAN
+
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    LDR     R2, =(INSTR_NOP | (EXT_LEVEL << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R0, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.SET_ZOOM_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size API_Set_Zoom, .-API_Set_Zoom
+
+@ --- API_Set_Zoom_Cache (R0=enable) ---
+@ Turns the zoom level cache of main.v on or off; it starts empty either
+@ way. The FSM stays in IDLE.
+
+.global API_Set_Zoom_Cache
+.type API_Set_Zoom_Cache, %function
+
+API_Set_Zoom_Cache:
+    PUSH    {R4, LR}
+    CMP     R0, #0
+    MOVNE   R0, #1
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    LDR     R2, =(INSTR_NOP | (EXT_CACHE << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R0, LSL #3  @ enable goes in address bit 0
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+    POP     {R4, PC}
+.size API_Set_Zoom_Cache, .-API_Set_Zoom_Cache
+
+@ --- API_Set_Zoom_Center (R0=x, R1=y) ---
+@ Only writes center_x/center_y in main.v (the FSM stays in IDLE); the
+@ next algorithms zoom around (x, y), clamped at the image edges.
+@ Returns 0 (success) or -1 (point outside 320x240)
+
+.global API_Set_Zoom_Center
+.type API_Set_Zoom_Center, %function
+
+API_Set_Zoom_Center:
+    PUSH    {R4, LR}
+    CMP     R0, #320
+    BHS     .ZOOM_CENTER_INVALID
+    CMP     R1, #240
+    BHS     .ZOOM_CENTER_INVALID
+
+    ORR     R0, R0, R1, LSL #9  @ MEM_ADDR = {y, x}
+    LDR     R4, =lw_bridge_ptr
+    LDR     R4, [R4]
+    LDR     R2, =(INSTR_NOP | (EXT_CENTER << INSTR_EXT_SHIFT))
+    ORR     R2, R2, R0, LSL #3
+    STR     R2, [R4, #PIO_INSTR_OFS]
+    DMB     sy
+    BL      _pulse_enable_safe
+
+    MOV     R0, #0
+    POP     {R4, PC}
+
+.ZOOM_CENTER_INVALID:
+    MOV     R0, #-1
+    POP     {R4, PC}
+.size API_Set_Zoom_Center, .-API_Set_Zoom_Center
+
 @ --- NearestNeighBor (void) ---
 .global NearestNeighbor
 .type NearestNeighbor, %function
@@ -383,7 +1518,7 @@ ASM_Pulse_Enable:
 NearestNeighbor:
     PUSH {LR}
     MOV R0, #INSTR_NHI_ALG       @ opcode
-    BL _ASM_Set_Instruction      @ calls internal function
+    BL _ASM_Set_Alg_Instruction  @ calls internal function
     POP {PC}                     @ return (no pulse, no wait)
 .size NearestNeighbor, .-NearestNeighbor
 
@@ -394,7 +1529,7 @@ NearestNeighbor:
 PixelReplication:
     PUSH {LR}
     MOV R0, #INSTR_PR_ALG
-    BL _ASM_Set_Instruction
+    BL _ASM_Set_Alg_Instruction
     POP {PC}
 .size PixelReplication, .-PixelReplication
 
@@ -405,7 +1540,7 @@ PixelReplication:
 Decimation:
     PUSH {LR}
     MOV R0, #INSTR_NH_ALG
-    BL _ASM_Set_Instruction
+    BL _ASM_Set_Alg_Instruction
     POP {PC}
 .size Decimation, .-Decimation
 
@@ -416,10 +1551,23 @@ Decimation:
 BlockAveraging:
     PUSH {LR}
     MOV R0, #INSTR_BA_ALG
-    BL _ASM_Set_Instruction
+    BL _ASM_Set_Alg_Instruction
     POP {PC}
 .size BlockAveraging, .-BlockAveraging
 
+@ --- BilinearZoom (void) ---
+@ NHI with EXT_BILINEAR: zoom in interpolated by zoom_bilinear_stream.v.
+@ Not affected by API_Set_Scanout (the scan-out remap is nearest neighbour)
+.global BilinearZoom
+.type BilinearZoom, %function
+
+BilinearZoom:
+    PUSH {LR}
+    LDR R0, =(INSTR_NHI_ALG | (EXT_BILINEAR << INSTR_EXT_SHIFT))
+    BL _ASM_Set_Instruction
+    POP {PC}
+.size BilinearZoom, .-BilinearZoom
+
 @ --- RESET FUNCTION ---
 @ --- ASM_Run_Reset (void) ---
 @ Resets the coprocessor internal state
@@ -1,148 +1,94 @@
 // Finalizado
+#define _DEFAULT_SOURCE
 #include "api.h"
+#include "image_io.h"
+#include "delta.h"
+#include "pipeline.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <unistd.h>
 #include <string.h>
+#include <time.h>
 
 #define MAX_IMAGES 10
 #define MAX_FILENAME 100
+#define WAIT_TIMEOUT_US 5000000
 
-// Estrutura do cabeçalho BMP (14 bytes)
-#pragma pack(push, 1)
-typedef struct {
-    uint16_t type;
-    uint32_t size;
-    uint16_t reserved1;
-    uint16_t reserved2;
-    uint32_t offset;
-} BMPHeader;
+// Lista de imagens disponíveis
+static const char *const images[MAX_IMAGES] = {
+    "Xadrez.bmp",
+    "imagem1.bmp",
+    "imagem2.bmp",
+    "imagem3.bmp",
+    "imagem4.bmp",
+    "imagem5.bmp",
+    "imagem6.bmp",
+    "imagem7.bmp",
+    "imagem8.bmp",
+    "imagem9.bmp"
+};
 
-typedef struct {
-    uint32_t size;
-    int32_t  width;
-    int32_t  height;
-    uint16_t planes;
-    uint16_t bits;
-    uint32_t compression;
-    uint32_t imagesize;
-    int32_t  xresolution;
-    int32_t  yresolution;
-    uint32_t ncolours;
-    uint32_t importantcolours;
-} BMPInfoHeader;
-#pragma pack(pop)
-
-// Converte RGB para Grayscale
-uint8_t rgb_to_gray(uint8_t r, uint8_t g, uint8_t b) {
-    return (uint8_t)((299 * r + 587 * g + 114 * b) / 1000);
-}
-
-// Carrega imagem BMP
-int load_bmp(const char *filename, uint8_t *image_data) {
-    FILE *file;
-    BMPHeader header;
-    BMPInfoHeader infoHeader;
-    
-    file = fopen(filename, "rb");
-    if (!file) {
-        printf("❌ Erro ao abrir '%s'\n", filename);
-        return -1;
-    }
-    
-    fread(&header, sizeof(BMPHeader), 1, file);
-    if (header.type != 0x4D42) {
-        printf("❌ Arquivo não é BMP válido\n");
-        fclose(file);
-        return -1;
-    }
-    
-    fread(&infoHeader, sizeof(BMPInfoHeader), 1, file);
-    
-    if (infoHeader.width != IMG_WIDTH || abs(infoHeader.height) != IMG_HEIGHT) {
-        printf("❌ Dimensão incorreta: %dx%d (esperado 320x240)\n", 
-               infoHeader.width, abs(infoHeader.height));
-        fclose(file);
-        return -1;
-    }
-    
-    fseek(file, header.offset, SEEK_SET);
-    
-    int bytes_per_pixel = infoHeader.bits / 8;
-    int row_size = ((infoHeader.width * bytes_per_pixel + 3) / 4) * 4;
-    uint8_t *row_data = (uint8_t*)malloc(row_size);
-    
-    printf("Carregando");
-    for (int y = 0; y < IMG_HEIGHT; y++) {
-        fread(row_data, 1, row_size, file);
-        
-        for (int x = 0; x < IMG_WIDTH; x++) {
-            uint8_t gray;
-            
-            if (infoHeader.bits == 32) {
-                uint8_t b = row_data[x * 4 + 0];
-                uint8_t g = row_data[x * 4 + 1];
-                uint8_t r = row_data[x * 4 + 2];
-                gray = rgb_to_gray(r, g, b);
-            } else if (infoHeader.bits == 24) {
-                uint8_t b = row_data[x * 3 + 0];
-                uint8_t g = row_data[x * 3 + 1];
-                uint8_t r = row_data[x * 3 + 2];
-                gray = rgb_to_gray(r, g, b);
-            } else if (infoHeader.bits == 8) {
-                gray = row_data[x];
-            } else {
-                printf("\n❌ Formato %d bits não suportado\n", infoHeader.bits);
-                free(row_data);
-                fclose(file);
-                return -1;
+// Espera o FLAG_DONE do comando em curso: interrupção se houver, senão
+// polling. 0 (Concluído), -2 (Timeout) ou -3 (FLAG_ERROR)
+static int wait_done(void) {
+    int status = API_Wait_Done(WAIT_TIMEOUT_US);
+    if (status == -1) {
+        struct timespec t0, t;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        while (!ASM_Get_Flag_Done()) {
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            if ((t.tv_sec - t0.tv_sec) * 1000000L + (t.tv_nsec - t0.tv_nsec) / 1000 > WAIT_TIMEOUT_US) {
+                return -2;
             }
-            
-            int addr = (IMG_HEIGHT - 1 - y) * IMG_WIDTH + x;
-            image_data[addr] = gray;
-        }
-        
-        if (y % 60 == 0) {
-            printf(".");
-            fflush(stdout);
         }
+        status = ASM_Get_Flag_Error() ? -3 : 0;
     }
-    
-    printf(" OK!\n");
-    free(row_data);
-    fclose(file);
-    return 0;
+    return status;
 }
 
 // Envia imagem para FPGA
-int send_to_fpga(uint8_t *image_data) {
-    int total_pixels = IMG_WIDTH * IMG_HEIGHT;
-    int errors = 0;
+// Só os trechos que mudaram desde o último envio (delta.c); o primeiro
+// quadro vai inteiro pela janela VRAM, pelo DMA ou por STOREs em blocos.
+// Retorna em upload_ms o tempo gasto no envio dos pixels e em bus_bytes
+// os bytes que cruzaram a ponte (ambos podem ser NULL)
+int send_to_fpga(uint8_t *image_data, double *upload_ms, uint32_t *bus_bytes) {
+    DeltaStats delta;
+    int status;
+    struct timespec t0, t1;
     
     printf("Enviando para FPGA");
-    for (int i = 0; i < total_pixels; i++) {
-        if (ASM_Store(i, image_data[i]) != 0) {
-            errors++;
-        }
-        
-        if (i % (total_pixels / 10) == 0) {
-            printf(".");
-            fflush(stdout);
-        }
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    status = delta_upload(image_data, &delta);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    
+    double elapsed_ms = (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+    if (upload_ms) {
+        *upload_ms = elapsed_ms;
+    }
+    if (bus_bytes) {
+        *bus_bytes = delta.bus_bytes;
     }
     
-    printf(" OK!\n");
+    if (status != STORE_SUCCESS) {
+        printf("\n⚠️  Erro %d ao enviar pixels\n", status);
+        return -1;
+    }
     
-    ASM_Refresh();
-    usleep(100000);
+    if (delta.full) {
+        printf(" OK! (%.1f ms, quadro inteiro, %u bytes pela ponte)\n", elapsed_ms, delta.bus_bytes);
+    } else {
+        printf(" OK! (%.1f ms, %u trechos, %u bytes pela ponte)\n", elapsed_ms, delta.spans, delta.bus_bytes);
+    }
     
-    if (errors > 0) {
-        printf("⚠️  %d erros ao enviar pixels\n", errors);
+    ASM_Refresh();
+    status = wait_done();
+    if (status == -2) {
+        printf("❌ Timeout esperando o FLAG_DONE!\n");
         return -1;
     }
-    
-    if (ASM_Get_Flag_Error()) {
+    if (status != 0) {
         printf("❌ Hardware reportou erro!\n");
         return -1;
     }
@@ -165,6 +111,8 @@ void print_main_menu() {
     printf("  [2] Aplicar Zoom\n");
     printf("  [3] ASM_Reset do Sistema\n");
     printf("  [4] Status\n");
+    printf("  [5] Capturar Tela (BMP/PGM)\n");
+    printf("  [6] Apresentação de Slides\n");
     printf("  [0] Sair\n\n");
     printf("Escolha: ");
 }
@@ -176,20 +124,6 @@ int select_image_menu(char *filename) {
     printf("║         SELECIONE UMA IMAGEM (BMP)        ║\n");
     printf("╚════════════════════════════════════════════╝\n\n");
     
-    // Lista de imagens disponíveis
-    char images[MAX_IMAGES][MAX_FILENAME] = {
-        "Xadrez.bmp",
-        "imagem1.bmp",
-        "imagem2.bmp",
-        "imagem3.bmp",
-        "imagem4.bmp",
-        "imagem5.bmp",
-        "imagem6.bmp",
-        "imagem7.bmp",
-        "imagem8.bmp",
-        "imagem9.bmp"
-    };
-    
     int available_count = 0;
     FILE *test_file;
     
@@ -297,12 +231,16 @@ void execute_zoom(int algorithm) {
     
     // Aguarda conclusão
     printf("Processando");
-    int timeout = 0;
-    while (!ASM_Get_Flag_Done() && timeout < 50) {
-        printf(".");
-        fflush(stdout);
-        usleep(100000); // 100ms
-        timeout++;
+    fflush(stdout);
+    // Dorme na interrupção de FLAG_DONE/FLAG_ERROR; sem /dev/uio0, faz polling
+    if (API_Wait_Done(5000000) == -1) {
+        int timeout = 0;
+        while (!ASM_Get_Flag_Done() && timeout < 50) {
+            printf(".");
+            fflush(stdout);
+            usleep(100000); // 100ms
+            timeout++;
+        }
     }
     
     if (ASM_Get_Flag_Done()) {
@@ -326,6 +264,105 @@ void execute_zoom(int algorithm) {
     getchar();
 }
 
+// Lê a imagem exibida (MEM_DISPLAY) de volta e salva em arquivo. Usa um
+// buffer próprio: a imagem carregada continua a ser a origem dos zooms
+void capture_frame(void) {
+    struct timespec t0, t1;
+    uint8_t *buffer = (uint8_t*)malloc(IMG_SIZE);
+
+    if (!buffer) {
+        printf("\n❌ Erro ao alocar memória!\n");
+        sleep(2);
+        return;
+    }
+
+    printf("\nCapturando tela");
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (API_Read_Frame(MEM_DISPLAY, buffer) != 0) {
+        printf(" ERRO!\n");
+        printf("❌ Janela VRAM indisponível\n");
+    } else {
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double ms = (t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+        printf(" OK! (%.1f ms)\n", ms);
+
+        if (save_bmp("captura.bmp", buffer, IMG_WIDTH, IMG_HEIGHT) == 0 &&
+            save_pgm("captura.pgm", buffer, IMG_WIDTH, IMG_HEIGHT) == 0) {
+            printf("✅ Salva em captura.bmp e captura.pgm\n");
+        } else {
+            printf("❌ Erro ao salvar a captura\n");
+        }
+    }
+    free(buffer);
+
+    printf("\nPressione ENTER para continuar...");
+    getchar();
+}
+
+// Estágio de envio da apresentação: só o que mudou, trocado na tela no vsync.
+// O FLAG_DONE sobe junto com a troca: esperar por ele deixa o FSM no IDLE,
+// o único estado que aceita o próximo envio
+static int show_slide(const uint8_t *frame, int index, const char *filename, void *user) {
+    DeltaStats delta;
+    int status = delta_upload(frame, &delta);
+    if (status != 0) {
+        printf("  [%d] %-14s ❌ erro %d no envio\n", index + 1, filename, status);
+    } else {
+        ASM_Refresh_Vsync();
+        status = wait_done();
+        if (status == 0) {
+            memcpy(user, frame, IMG_SIZE); // último quadro exibido
+            printf("  [%d] %-14s %6u bytes pela ponte\n", index + 1, filename, delta.bus_bytes);
+        } else {
+            printf("  [%d] %-14s ❌ %s na troca de buffer\n", index + 1, filename,
+                   status == -2 ? "timeout" : "erro do hardware");
+        }
+    }
+    fflush(stdout);
+    return status;
+}
+
+// Apresentação de slides: decodifica a próxima imagem enquanto envia a atual
+int slideshow(uint8_t *image_data) {
+    const char *files[MAX_IMAGES];
+    int count = 0;
+    unsigned int seconds;
+    PipelineStats st;
+
+    clear_screen();
+    for (int i = 0; i < MAX_IMAGES; i++) {
+        if (access(images[i], R_OK) == 0) {
+            files[count++] = images[i];
+        }
+    }
+    if (count == 0) {
+        printf("❌ Nenhuma imagem BMP encontrada!\n");
+        sleep(2);
+        return -1;
+    }
+
+    printf("Segundos por imagem (0 = o mais rápido possível): ");
+    if (scanf("%u", &seconds) != 1) {
+        seconds = 0;
+    }
+    getchar();
+
+    printf("\nApresentando %d imagens...\n", count);
+    int result = pipeline_run(files, count, 2, seconds * 1000, show_slide, image_data, &st);
+
+    printf("\nTempo total: %.1f ms para %u imagens (%u com erro)\n", st.wall_ms, st.frames, st.failed);
+    printf("  - Decodificação: %.1f ms (pior %.1f ms), esperou %.1f ms por slot livre\n",
+           st.decode_ms, st.decode_max_ms, st.producer_blocked_ms);
+    printf("  - Envio:         %.1f ms (pior %.1f ms), esperou %.1f ms por quadro pronto\n",
+           st.upload_ms, st.upload_max_ms, st.consumer_starved_ms);
+    printf("  - Gargalo: %s\n", st.decode_ms > st.upload_ms ? "decodificação (load_bmp)" : "envio para o FPGA");
+
+    printf("\nPressione ENTER para continuar...");
+    getchar();
+    return (result == 0 && st.frames > 0) ? 0 : -1;
+}
+
 // Mostra status do sistema
 void show_status() {
     clear_screen();
@@ -339,6 +376,19 @@ void show_status() {
     printf("  - ZOOM_MAX: %s\n", ASM_Get_Flag_Max_Zoom() ? "✓ Sim (8x)" : "✗ Não");
     printf("  - ZOOM_MIN: %s\n", ASM_Get_Flag_Min_Zoom() ? "✓ Sim (0.125x)" : "✗ Não");
     
+    PerfCounters perf;
+    if (API_Read_Perf_Counters(&perf) == 0) {
+        printf("\nDESEMPENHO (FPGA):\n");
+        printf("  - Comandos concluídos: %u\n", perf.ops_done);
+        printf("  - Último comando: %u ciclos (%.3f ms)\n", perf.last_op_cycles,
+               perf.last_op_cycles * 1e3 / PERF_CLOCK_HZ);
+        printf("  - Algoritmo / cópia: %.1f ms / %.1f ms\n",
+               (perf.state_cycles[PERF_ST_ALGORITHM] + perf.state_cycles[PERF_ST_WAIT_WR_OR_RD] +
+                perf.state_cycles[PERF_ST_STREAM]) * 1e3 / PERF_CLOCK_HZ,
+               perf.state_cycles[PERF_ST_COPY_READ] * 1e3 / PERF_CLOCK_HZ);
+        printf("  - VGA: %u quadros varridos, %u trocas de buffer\n", perf.vsyncs, perf.flips);
+    }
+    
     printf("\nDIMENSÕES SUPORTADAS:\n");
     printf("  - Resolução: 320x240 pixels\n");
     printf("  - Formato: BMP (8, 24 ou 32 bits)\n");
@@ -386,12 +436,19 @@ int main() {
                     }
                     
                     // Carrega imagem
+                    printf("Carregando");
+                    fflush(stdout);
                     if (load_bmp(filename, image_data) == 0) {
-                        if (send_to_fpga(image_data) == 0) {
+                        printf(" OK!\n");
+                        double upload_ms = 0.0;
+                        uint32_t bus_bytes = 0;
+                        if (send_to_fpga(image_data, &upload_ms, &bus_bytes) == 0) {
                             image_loaded = 1;
                             strcpy(current_image, filename);
                             printf("\n✅ '%s' carregada com sucesso!\n", filename);
                             printf("   Imagem visível na VGA.\n");
+                            printf("   Upload: %.1f ms (%u bytes, %.1f KB/s)\n", upload_ms, bus_bytes,
+                                   upload_ms > 0 ? (bus_bytes / 1024.0) / (upload_ms / 1000.0) : 0.0);
                         } else {
                             printf("\n❌ Erro ao enviar imagem para FPGA\n");
                         }
@@ -437,6 +494,31 @@ int main() {
                 break;
             }
             
+            case 5: { // Capturar Tela
+                if (!system_initialized) {
+                    printf("\n⚠️  Carregue uma imagem primeiro!\n");
+                    sleep(2);
+                    break;
+                }
+                capture_frame();
+                break;
+            }
+            
+            case 6: { // Apresentação de Slides
+                if (!system_initialized) {
+                    printf("\nInicializando sistema...\n");
+                    API_initialize();
+                    ASM_Reset();
+                    usleep(10000);
+                    system_initialized = 1;
+                }
+                if (slideshow(image_data) == 0) {
+                    image_loaded = 1;
+                    strcpy(current_image, "(apresentação)");
+                }
+                break;
+            }
+            
             case 0: { // Sair
                 printf("\nEncerrando...\n");
                 free(image_data);
@@ -13,7 +13,7 @@
  * FLUXO:
  * 1. Inicializa a API (API_initialize)
  * 2. Carrega imagem (BMP ou Gradiente)
- * 3. Envia imagem para o FPGA (Testa ASM_Store e ASM_Refresh)
+ * 3. Envia imagem para o FPGA (Testa ASM_Store, ASM_Store_Block e ASM_Refresh)
  * 4. Lê todas as flags de status (Get_Flag_*)
  * 5. Executa CADA algoritmo (NearestNeighbor, PixelReplication, etc.)
  * 6. Lê todas as flags de status novamente
@@ -22,11 +22,13 @@
  *
  */
 
+#define _DEFAULT_SOURCE
 #include "api.h" // O seu ficheiro .h
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <unistd.h> // Para usleep()
+#include <time.h>   // Para clock_gettime()
 // (stdlib.h já inclui abs() para inteiros)
 
 // Definimos um timeout de C (número de loops de 100ms)
@@ -186,37 +188,37 @@ void gerar_padrao_teste(uint8_t *image_data) {
 
 /**
  * @brief Envia o buffer de imagem para a VRAM do FPGA.
- * (Testa implicitamente ASM_Store e ASM_Refresh)
+ * (Testa ASM_Store no primeiro pixel, ASM_Store_Block no resto e ASM_Refresh)
  */
 int enviar_imagem_para_fpga(uint8_t *image_data) {
     int total_pixels = IMG_WIDTH * IMG_HEIGHT;
-    int errors = 0;
+    struct timespec t0, t1;
 
-    printf("   [C] Enviando %d pixels para o FPGA (testando ASM_Store)...\n", total_pixels);
-    
-    for (int i = 0; i < total_pixels; i++) {
-        int status = ASM_Store(i, image_data[i]);
-        if (status != 0) {
-            printf("\n   [C] ERRO: ASM_Store falhou no pixel %d (codigo %d)\n", i, status);
-            errors++;
-            if (errors > 10) { // Evita spam
-                printf("   [C] Muitos erros, abortando envio.\n");
-                return -1;
-            }
-        }
+    printf("   [C] Enviando pixel 0 para o FPGA (testando ASM_Store)...\n");
+    int status = ASM_Store(0, image_data[0]);
+    if (status != STORE_SUCCESS) {
+        printf("   [C] ERRO: ASM_Store falhou no pixel 0 (codigo %d)\n", status);
+        return -1;
     }
-    
-    printf("   [C] Envio de pixels OK.\n");
+
+    printf("   [C] Enviando %d pixels para o FPGA (testando ASM_Store_Block)...\n", total_pixels - 1);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    status = ASM_Store_Block(1, image_data + 1, total_pixels - 1);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (status != STORE_SUCCESS) {
+        printf("   [C] ERRO: ASM_Store_Block falhou (codigo %d)\n", status);
+        return -1;
+    }
+
+    double elapsed_ms = (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+    printf("   [C] Envio de pixels OK em %.1f ms (%.2f us/pixel).\n",
+           elapsed_ms, elapsed_ms * 1000.0 / (total_pixels - 1));
     
     // Envia o comando de refresh
     printf("   [C] Testando ASM_Refresh()...\n");
     ASM_Refresh();
     usleep(100000); // 100ms de espera
 
-    if (errors > 0) {
-        printf("   [C] ERRO: %d falhas de escrita de pixel.\n", errors);
-        return -1;
-    }
     return 0;
 }
 
@@ -233,9 +235,17 @@ int executar_algoritmo(const char *nome_algoritmo, void (*funcao_algoritmo)(void
     // 1. Define a instrução E INICIA o hardware
     funcao_algoritmo(); 
     
-    printf("   [C] Hardware iniciado. Aguardando FLAG_DONE (polling)...\n");
+    printf("   [C] Hardware iniciado. Aguardando FLAG_DONE (interrupcao)...\n");
+
+    // 2. Dorme na IRQ de pio_FLAGS; -1 = sem /dev/uio0, cai no polling abaixo
+    int espera = API_Wait_Done(C_TIMEOUT_LOOPS * 100000);
+    if (espera == -2) {
+        printf("\n   [C] ERRO FATAL: TIMEOUT DO ALGORITMO '%s'!\n", nome_algoritmo);
+        printf("   [C] O FPGA não respondeu após %d segundos.\n", C_TIMEOUT_LOOPS / 10);
+        return -1; // Falha
+    }
 
-    // 2. Fazer polling (sondagem) da flag em C com TIMEOUT
+    // 2b. Fazer polling (sondagem) da flag em C com TIMEOUT
     int timeout_c = 0;
     while (ASM_Get_Flag_Done() == 0) {
         usleep(100000); // Espera 100ms
@@ -0,0 +1,160 @@
+#define _DEFAULT_SOURCE
+#include "pipeline.h"
+#include "api.h"
+#include "image_io.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    const char *const *files;
+    int count;
+    int ring;
+
+    uint8_t *frames;              // ring * IMG_SIZE
+    int status[PIPELINE_MAX_RING]; // resultado do load_bmp de cada slot
+    int head, tail, filled;       // produtora escreve em head, consumidor lê em tail
+    int stop;
+
+    pthread_mutex_t lock;
+    pthread_cond_t  not_full, not_empty;
+
+    // tempos da produtora (lidos só depois do join)
+    double decode_ms, decode_max_ms, blocked_ms;
+} Pipeline;
+
+static double now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+// Estágio 1: decodifica cada arquivo no próximo slot livre
+static void *producer(void *arg) {
+    Pipeline *p = arg;
+
+    for (int i = 0; i < p->count; i++) {
+        double t0 = now_ms();
+        pthread_mutex_lock(&p->lock);
+        while (p->filled == p->ring && !p->stop) {
+            pthread_cond_wait(&p->not_full, &p->lock);
+        }
+        int stop = p->stop;
+        int slot = p->head;
+        pthread_mutex_unlock(&p->lock);
+        if (stop) {
+            break;
+        }
+
+        double t1 = now_ms();
+        int status = load_bmp(p->files[i], p->frames + (size_t)slot * IMG_SIZE);
+        double t2 = now_ms();
+        p->blocked_ms += t1 - t0;
+        p->decode_ms += t2 - t1;
+        if (t2 - t1 > p->decode_max_ms) {
+            p->decode_max_ms = t2 - t1;
+        }
+
+        pthread_mutex_lock(&p->lock);
+        p->status[slot] = status;
+        p->head = (slot + 1) % p->ring;
+        p->filled++;
+        pthread_cond_signal(&p->not_empty);
+        pthread_mutex_unlock(&p->lock);
+    }
+    return NULL;
+}
+
+int pipeline_run(const char *const *files, int count, int ring, unsigned int hold_ms,
+                 pipeline_frame_fn on_frame, void *user, PipelineStats *stats) {
+    PipelineStats st;
+    Pipeline p;
+    pthread_t thread;
+    int result = 0;
+
+    if (!files || count < 0 || ring < 2 || ring > PIPELINE_MAX_RING || !on_frame) {
+        return -1;
+    }
+
+    memset(&st, 0, sizeof(st));
+    memset(&p, 0, sizeof(p));
+    p.files = files;
+    p.count = count;
+    p.ring = ring;
+    p.frames = malloc((size_t)ring * IMG_SIZE);
+    if (!p.frames) {
+        return -1;
+    }
+    pthread_mutex_init(&p.lock, NULL);
+    pthread_cond_init(&p.not_full, NULL);
+    pthread_cond_init(&p.not_empty, NULL);
+
+    double start = now_ms();
+    if (pthread_create(&thread, NULL, producer, &p) != 0) {
+        result = -1;
+        goto out;
+    }
+
+    // Estágio 2 (esta thread): entrega cada quadro ao callback
+    for (int i = 0; i < count; i++) {
+        double t0 = now_ms();
+        pthread_mutex_lock(&p.lock);
+        while (p.filled == 0) {
+            pthread_cond_wait(&p.not_empty, &p.lock);
+        }
+        int slot = p.tail;
+        pthread_mutex_unlock(&p.lock);
+        double t1 = now_ms();
+        st.consumer_starved_ms += t1 - t0;
+
+        int stop = 0;
+        int decoded = (p.status[slot] == 0);
+        if (decoded) {
+            stop = on_frame(p.frames + (size_t)slot * IMG_SIZE, i, files[i], user);
+            double t2 = now_ms();
+            st.upload_ms += t2 - t1;
+            if (t2 - t1 > st.upload_max_ms) {
+                st.upload_max_ms = t2 - t1;
+            }
+            st.frames++;
+        } else {
+            st.failed++;
+        }
+
+        // libera o slot antes da pausa: a produtora já adianta o próximo
+        pthread_mutex_lock(&p.lock);
+        p.tail = (slot + 1) % p.ring;
+        p.filled--;
+        if (stop) {
+            p.stop = 1;
+        }
+        pthread_cond_signal(&p.not_full);
+        pthread_mutex_unlock(&p.lock);
+
+        if (stop) {
+            result = 1;
+            break;
+        }
+        if (hold_ms && decoded) {
+            usleep(hold_ms * 1000);
+        }
+    }
+
+    pthread_join(thread, NULL);
+    st.wall_ms = now_ms() - start;
+    st.decode_ms = p.decode_ms;
+    st.decode_max_ms = p.decode_max_ms;
+    st.producer_blocked_ms = p.blocked_ms;
+
+out:
+    pthread_cond_destroy(&p.not_empty);
+    pthread_cond_destroy(&p.not_full);
+    pthread_mutex_destroy(&p.lock);
+    free(p.frames);
+    if (stats) {
+        *stats = st;
+    }
+    return result;
+}
@@ -0,0 +1,62 @@
+/*
+ * =========================================================================
+ * pipeline.h: Carregamento em Paralelo (decodifica o próximo enquanto envia)
+ * =========================================================================
+ *
+ * Uma thread produtora decodifica os BMPs (load_bmp) num anel de quadros
+ * alocados no início; a thread que chamou pipeline_run consome os quadros
+ * na ordem e os entrega ao callback (ex: delta_upload + ASM_Refresh).
+ * Só o consumidor fala com o FPGA, então a api.h não precisa ser
+ * thread-safe. Com o anel cheio a produtora espera (contrapressão).
+ *
+ * Compilar com -pthread.
+ *
+ * #include "pipeline.h"
+ *
+ */
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PIPELINE_MAX_RING 8
+
+typedef struct {
+    uint32_t frames;              // quadros entregues ao callback
+    uint32_t failed;              // arquivos que não decodificaram
+    double   wall_ms;             // tempo total do pipeline_run
+    double   decode_ms;           // estágio 1 (load_bmp): soma e pior caso
+    double   decode_max_ms;
+    double   upload_ms;           // estágio 2 (callback): soma e pior caso
+    double   upload_max_ms;
+    double   producer_blocked_ms; // produtora esperando slot livre (envio é o gargalo)
+    double   consumer_starved_ms; // consumidor esperando quadro pronto (decodificação é o gargalo)
+} PipelineStats;
+
+/*
+ * Recebe cada quadro decodificado, na ordem dos arquivos.
+ * Retorne 0 para continuar ou outro valor para parar o pipeline.
+ */
+typedef int (*pipeline_frame_fn)(const uint8_t *frame, int index, const char *filename, void *user);
+
+/**
+ * @brief Decodifica e entrega os arquivos em dois estágios paralelos.
+ * @param files Caminhos dos BMPs (IMG_WIDTH x IMG_HEIGHT).
+ * @param ring Quadros no anel (2 a PIPELINE_MAX_RING; 2 = buffer duplo).
+ * @param hold_ms Pausa após cada quadro (ex: apresentação de slides), fora do tempo dos estágios.
+ * @param stats Recebe os tempos de cada estágio (pode ser NULL).
+ * @return 0 (Sucesso), 1 (o callback parou) ou -1 (parâmetros inválidos / sem memória ou thread).
+ */
+int pipeline_run(const char *const *files, int count, int ring, unsigned int hold_ms,
+                 pipeline_frame_fn on_frame, void *user, PipelineStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,60 @@
+#include "rle.h"
+#include <string.h>
+
+#define RLE_MAX_LITERAL 128
+#define RLE_MAX_RUN     129
+
+size_t rle_encode(const uint8_t *in, size_t n, uint8_t *out) {
+    size_t i = 0, o = 0;
+
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < RLE_MAX_RUN && in[i + run] == in[i]) {
+            run++;
+        }
+
+        if (run >= 2) {
+            out[o++] = (uint8_t)(run + 126);
+            out[o++] = in[i];
+            i += run;
+        } else {
+            // literais até o começo de uma repetição de 3 ou mais
+            // (uma de 2 custa o mesmo dentro dos literais)
+            size_t start = i, len = 0;
+            while (i < n && len < RLE_MAX_LITERAL) {
+                if (i + 2 < n && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                    break;
+                }
+                i++;
+                len++;
+            }
+            out[o++] = (uint8_t)(len - 1);
+            memcpy(out + o, in + start, len);
+            o += len;
+        }
+    }
+    return o;
+}
+
+size_t rle_decode(const uint8_t *in, size_t n, uint8_t *out, size_t out_max) {
+    size_t i = 0, o = 0;
+
+    while (i < n) {
+        uint8_t c = in[i++];
+        if (c & 0x80) {
+            if (i >= n) {
+                break;
+            }
+            for (unsigned k = 0; k < c - 126u; k++, o++) {
+                if (o < out_max) out[o] = in[i];
+            }
+            i++;
+        } else {
+            for (unsigned k = 0; k <= c && i < n; k++, o++) {
+                if (o < out_max) out[o] = in[i];
+                i++;
+            }
+        }
+    }
+    return o;
+}
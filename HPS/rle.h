@@ -0,0 +1,46 @@
+/*
+ * =========================================================================
+ * rle.h: Compressão RLE de Quadros para o DMA
+ * =========================================================================
+ *
+ * Codifica um quadro no formato que o dma_reader.v expande direto na mem1
+ * (ASM_Dma_Upload_Rle), um pixel por ciclo:
+ *   c < 128:  c + 1 pixels literais seguem (1 a 128)
+ *   c >= 128: o próximo byte se repete c - 126 vezes (2 a 129)
+ *
+ * #include "rle.h"
+ *
+ */
+
+#ifndef RLE_H_
+#define RLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Pior caso: só literais, um byte de controle a cada 128 pixels */
+#define RLE_MAX_ENCODED(n) ((n) + ((n) + 127) / 128)
+
+/**
+ * @brief Comprime n pixels.
+ * @param out Destino de pelo menos RLE_MAX_ENCODED(n) bytes.
+ * @return O tamanho comprimido em bytes.
+ */
+size_t rle_encode(const uint8_t *in, size_t n, uint8_t *out);
+
+/**
+ * @brief Expande um quadro comprimido (o mesmo que o FPGA faz).
+ * @param out Destino de out_max bytes; o que passar disso é descartado.
+ * @return O número de pixels gerados.
+ */
+size_t rle_decode(const uint8_t *in, size_t n, uint8_t *out, size_t out_max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
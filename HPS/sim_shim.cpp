@@ -0,0 +1,587 @@
+/*
+ * =========================================================================
+ * sim_shim.cpp: Co-simulação do main.v (Verilator) por trás da api.h
+ * =========================================================================
+ *
+ * Implementa a api.h dirigindo o RTL real (FPGA/main.v, compilado pelo
+ * Verilator com os modelos comportamentais de FPGA/sim/) ciclo a ciclo.
+ * Um programa de teste (ex: main_full_test.c, sem modificações) é ligado
+ * a este ficheiro no lugar do lib.s.
+ *
+ * - Cada tick é um ciclo do clk_100 (o modelo do pll repassa o refclk).
+ * - Os PIOs são decodificados como no ghrd_top.v; a janela VRAM e o
+ *   mestre DMA são atendidos pelo protocolo Avalon-MM, ciclo a ciclo.
+ * - Cada comando conta os ciclos desde a borda de descida do ENABLE até
+ *   o FLAG_DONE com a FSM no IDLE, separando os ciclos de cópia da mem1 para o
+ *   buffer de trás (COPY_READ). Algoritmos e cópias são impressos em
+ *   stderr na hora; o resumo de todos os comandos sai no API_close.
+ * - SIM_VGA_DUMP=prefixo grava cada quadro varrido pelo VGA (640x480)
+ *   em prefixo_NNNN.pgm; o API_close ainda varre um quadro inteiro.
+ *
+ * Uso: make sim_test (ver makefile). Requer Verilator 5.
+ *
+ */
+
+#include "api.h"
+
+#include "Vmain.h"
+#include "Vmain___024root.h"
+#include "verilated.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+/* ===================================================================
+ * Constantes (as mesmas do lib.s / main.v)
+ * =================================================================== */
+
+enum { OP_REFRESH = 0, OP_LOAD, OP_STORE, OP_NHI_ALG, OP_PR_ALG, OP_BA_ALG, OP_NH_ALG, OP_RESET };
+enum { EXT_NONE = 0, EXT_PACKED = 1, EXT_DMA = 2, EXT_SPANS = 3, EXT_RLE = 4, EXT_VSYNC = 5, EXT_SCAN = 6, EXT_SCALE = 7,
+       EXT_CACHE = 1, EXT_LEVEL = 4, EXT_CENTER = 6, EXT_BILINEAR = 7 }; // EXT_CACHE/EXT_LEVEL/EXT_CENTER/EXT_SCALE no REFRESH, EXT_SCAN/EXT_BILINEAR nos algoritmos
+enum { ST_IDLE = 0, ST_READ_AND_WRITE, ST_ALGORITHM, ST_RESET, ST_COPY_READ, ST_STREAM, ST_DMA_WAIT, ST_WAIT_WR_OR_RD };
+
+static const uint32_t DMA_POOL_BASE = 0x3F000000u;
+static const uint32_t DMA_POOL_SPAN = 0x01000000u;
+static const uint64_t CMD_TIMEOUT   = 50000000; // 0.5 s de clk_100
+
+static const char *const op_names[] = {
+    "REFRESH", "LOAD", "STORE", "NHI_ALG", "PR_ALG", "BA_ALG", "NH_ALG", "RESET"
+};
+
+/* ===================================================================
+ * Estado da simulação
+ * =================================================================== */
+
+static VerilatedContext *ctx;
+static Vmain *top;
+static uint64_t cycles; // ciclos de clk_100 desde o API_initialize
+
+// PIOs vistos pelo HPS
+static uint32_t pio_instruction;
+static uint32_t alg_ext; // API_Set_Scanout (no lib.s, alg_ext)
+static uint32_t pio_data;
+
+// Pool de DMA (memória "física" vista pelo mestre DMA)
+static std::vector<uint8_t> dma_pool;
+static uint32_t dma_pool_used;
+
+struct DmaBurst {
+    uint32_t addr;
+    unsigned left;
+};
+static std::deque<DmaBurst> dma_bursts;
+
+// Estatística por comando (índice: opcode; 8 = STORE empacotado, 9 = DMA, 10 = DMA de trechos, 11 = DMA RLE,
+// 12 = REFRESH com troca no vsync, 13 = zoom fracionário)
+struct OpStats {
+    uint64_t count, total, min, max, copy;
+};
+static OpStats stats[17];
+
+// Captura do VGA
+static const char *vga_prefix;
+static std::vector<uint8_t> vga_frame(640 * 480);
+static unsigned vga_frames;
+static int vga_clk_prev, vsync_prev;
+
+/* ===================================================================
+ * Relógio e portas Avalon
+ * =================================================================== */
+
+static void vga_sample_before_edge(int *active, unsigned *x, unsigned *y) {
+    Vmain___024root *r = top->rootp;
+    *active = r->main__DOT__vga_out__DOT__h_state == 0 && r->main__DOT__vga_out__DOT__v_state == 0;
+    *x = r->main__DOT__vga_out__DOT__h_counter;
+    *y = r->main__DOT__vga_out__DOT__v_counter;
+}
+
+// Um ciclo de clk_100. O mestre DMA é atendido como um escravo sem
+// waitrequest: cada rajada aceita devolve uma palavra por ciclo.
+static void tick(void) {
+    int vga_active;
+    unsigned vga_x, vga_y;
+
+    // dados da rajada mais antiga para esta borda
+    top->DMA_WAITREQUEST = 0;
+    top->DMA_READDATAVALID = 0;
+    if (!dma_bursts.empty()) {
+        DmaBurst &b = dma_bursts.front();
+        uint32_t word = 0;
+        if (b.addr >= DMA_POOL_BASE && b.addr - DMA_POOL_BASE + 4 <= dma_pool.size()) {
+            memcpy(&word, &dma_pool[b.addr - DMA_POOL_BASE], 4);
+        }
+        top->DMA_READDATA = word;
+        top->DMA_READDATAVALID = 1;
+        b.addr += 4;
+        if (--b.left == 0) {
+            dma_bursts.pop_front();
+        }
+    }
+
+    top->CLOCK_50 = 0;
+    top->eval();
+
+    // comando de leitura aceito nesta borda: dados a partir do próximo ciclo
+    if (top->DMA_READ) {
+        dma_bursts.push_back(DmaBurst{top->DMA_ADDRESS, top->DMA_BURSTCOUNT});
+    }
+    vga_sample_before_edge(&vga_active, &vga_x, &vga_y);
+
+    top->CLOCK_50 = 1;
+    top->eval();
+    cycles++;
+    ctx->timeInc(1);
+
+    // VGA: na subida do clk_25, VGA_R é o pixel amostrado antes da borda
+    if (vga_prefix) {
+        int vga_clk = top->VGA_CLK;
+        if (vga_clk && !vga_clk_prev && vga_active && vga_x < 640 && vga_y < 480) {
+            vga_frame[vga_y * 640 + vga_x] = top->VGA_R;
+        }
+        if (!top->VGA_V_SYNC_N && vsync_prev) {
+            char name[256];
+            snprintf(name, sizeof(name), "%s_%04u.pgm", vga_prefix, vga_frames++);
+            FILE *f = fopen(name, "wb");
+            if (f) {
+                fprintf(f, "P5\n640 480\n255\n");
+                fwrite(vga_frame.data(), 1, vga_frame.size(), f);
+                fclose(f);
+            }
+        }
+        vga_clk_prev = vga_clk;
+        vsync_prev = top->VGA_V_SYNC_N;
+    }
+}
+
+static unsigned uc_state(void) {
+    return top->rootp->main__DOT__uc_state;
+}
+
+// Escreve uma palavra (4 pixels, byteenable be) pela janela VRAM (espera no waitrequest)
+static void vram_write(uint32_t addr, uint32_t data, uint8_t be) {
+    top->VRAM_ADDRESS = addr;
+    top->VRAM_WRITEDATA = data;
+    top->VRAM_BYTEENABLE = be;
+    top->VRAM_WRITE = 1;
+    for (;;) {
+        top->CLOCK_50 = 0;
+        top->eval();
+        int accepted = !top->VRAM_WAITREQUEST;
+        tick();
+        if (accepted) {
+            break;
+        }
+    }
+    top->VRAM_WRITE = 0;
+}
+
+// Lê n bytes (múltiplo de 4) pela janela VRAM, uma palavra por leitura, em pipeline
+static void vram_read(uint32_t base, uint8_t *buf, uint32_t n) {
+    uint32_t issued = 0, received = 0;
+    while (received < n) {
+        top->VRAM_READ = issued < n;
+        top->VRAM_ADDRESS = base + issued;
+        top->CLOCK_50 = 0;
+        top->eval();
+        int accepted = top->VRAM_READ && !top->VRAM_WAITREQUEST;
+        tick();
+        if (accepted) {
+            issued += 4;
+        }
+        if (top->VRAM_READDATAVALID) {
+            uint32_t word = top->VRAM_READDATA;
+            memcpy(buf + received, &word, 4); // pixel de menor endereço no byte 0
+            received += 4;
+        }
+    }
+    top->VRAM_READ = 0;
+}
+
+/* ===================================================================
+ * PIOs e pulso de ENABLE
+ * =================================================================== */
+
+// Decodificação do ghrd_top.v
+static void drive_pios(void) {
+    uint32_t op = pio_instruction & 0x7;
+    int rw = (op == OP_STORE || op == OP_LOAD);
+    uint32_t ext = pio_instruction >> 29;
+    int param_op = (op == OP_REFRESH && ext != EXT_NONE && ext != EXT_VSYNC);
+    top->INSTRUCTION = op;
+    top->MEM_ADDR = (rw || param_op) ? (pio_instruction >> 3) & 0x1FFFF : 0;
+    top->DATA_IN = rw ? (pio_instruction >> 21) & 0xFF : 0;
+    top->SEL_MEM = (op == OP_LOAD) ? (pio_instruction >> 20) & 1 : 0;
+    top->EXT_OP = pio_instruction >> 29;
+    top->DATA_PACKED = pio_data;
+}
+
+// Pulsa o ENABLE e roda até o FLAG_DONE; registra os ciclos
+static void enable_pulse(void) {
+    uint32_t op = pio_instruction & 0x7;
+    uint32_t ext = pio_instruction >> 29;
+    int slot = (op == OP_REFRESH && ext == EXT_VSYNC) ? 12 : (op == OP_REFRESH && ext == EXT_SCALE) ? 13 :
+               (op == OP_REFRESH && ext == EXT_CENTER) ? 14 : (op == OP_REFRESH && ext == EXT_LEVEL) ? 15 :
+               (op == OP_REFRESH && ext == EXT_CACHE) ? 16 :
+               (op != OP_STORE) ? (int)op : (ext == EXT_PACKED) ? 8 : (ext == EXT_DMA) ? 9 : (ext == EXT_SPANS) ? 10 : (ext == EXT_RLE) ? 11 : (int)op;
+
+    drive_pios();
+    top->ENABLE = 1;
+    tick();
+    top->ENABLE = 0;
+
+    uint64_t start = cycles, copy = 0;
+    // a FSM sai do IDLE poucos ciclos após a borda (sincronização do ENABLE);
+    // comandos sem efeito (ex: zoom no limite) ficam no IDLE
+    for (int i = 0; i < 4 && uc_state() == ST_IDLE; i++) {
+        tick();
+    }
+    // como o HPS, espera também o FLAG_DONE: nas trocas de buffer ele só sobe
+    // no ciclo seguinte ao IDLE, depois da última escrita e da troca
+    while ((uc_state() != ST_IDLE || !top->FLAG_DONE) && cycles - start < CMD_TIMEOUT) {
+        unsigned st = uc_state();
+        tick();
+        if (st == ST_COPY_READ) {
+            copy++;
+        }
+    }
+
+    uint64_t n = cycles - start;
+    OpStats &s = stats[slot];
+    s.min = (s.count == 0 || n < s.min) ? n : s.min;
+    s.max = (n > s.max) ? n : s.max;
+    s.count++;
+    s.total += n;
+    s.copy += copy;
+
+    if (op != OP_STORE && op != OP_LOAD) {
+        fprintf(stderr, "[sim] %-8s %9llu ciclos (algoritmo %llu, cópia %llu), zoom %u\n",
+                op_names[op], (unsigned long long)n, (unsigned long long)(n - copy),
+                (unsigned long long)copy, (unsigned)top->rootp->main__DOT__current_zoom);
+    }
+}
+
+static void print_stats(void) {
+    static const char *const names[17] = {
+        "REFRESH", "LOAD", "STORE", "NHI_ALG", "PR_ALG", "BA_ALG", "NH_ALG", "RESET", "STORE_PK", "DMA", "DMA_SPAN", "DMA_RLE",
+        "REFRESH_V", "ZOOM_TO", "CENTER", "SET_ZOOM", "CACHE"
+    };
+    fprintf(stderr, "[sim] %-9s %8s %10s %10s %10s %10s\n", "comando", "n", "média", "mín", "máx", "cópia");
+    for (int i = 0; i < 17; i++) {
+        const OpStats &s = stats[i];
+        if (s.count) {
+            fprintf(stderr, "[sim] %-9s %8llu %10.1f %10llu %10llu %10.1f\n", names[i],
+                    (unsigned long long)s.count, (double)s.total / s.count,
+                    (unsigned long long)s.min, (unsigned long long)s.max, (double)s.copy / s.count);
+        }
+    }
+    fprintf(stderr, "[sim] total: %llu ciclos de clk_100 (%.3f ms a 100 MHz)\n",
+            (unsigned long long)cycles, cycles / 1e5);
+}
+
+/* ===================================================================
+ * api.h: Inicialização
+ * =================================================================== */
+
+static uint32_t fake_lw_bridge[0x50 / 4];
+
+volatile void* API_initialize(void) {
+    if (top) {
+        return fake_lw_bridge;
+    }
+    ctx = new VerilatedContext;
+    top = new Vmain{ctx};
+    vga_prefix = getenv("SIM_VGA_DUMP");
+
+    // ENABLE começa em 1: sem o pulso espúrio da partida (ENABLE = 0 com enable_ff = 0)
+    top->ENABLE = 1;
+    top->VRAM_READ = 0;
+    top->VRAM_WRITE = 0;
+    for (int i = 0; i < 8; i++) {
+        tick();
+    }
+    return fake_lw_bridge;
+}
+
+volatile uint8_t* API_Get_VRAM(void) {
+    return NULL; // sem ponteiro direto: use ASM_Upload_Frame / API_Read_Frame
+}
+
+void API_close(void) {
+    if (!top) {
+        return;
+    }
+    if (vga_prefix) {
+        for (int i = 0; i < 800 * 525 * 4; i++) { // um quadro inteiro do VGA
+            tick();
+        }
+    }
+    print_stats();
+    top->final();
+    delete top;
+    delete ctx;
+    top = NULL;
+    dma_pool.clear();
+    dma_pool_used = 0;
+}
+
+/* ===================================================================
+ * api.h: STORE / LOAD
+ * =================================================================== */
+
+static int wait_result(void) {
+    return top->FLAG_ERROR ? -3 : 0;
+}
+
+int ASM_Store(unsigned int address, unsigned char pixel_data) {
+    if (address >= IMG_SIZE) {
+        return -1;
+    }
+    pio_instruction = OP_STORE | (address << 3) | (1u << 20) | ((uint32_t)pixel_data << 21);
+    enable_pulse();
+    return wait_result();
+}
+
+int ASM_Store_Packed(unsigned int address, uint32_t pixels) {
+    if (address >= IMG_SIZE - 3) {
+        return -1;
+    }
+    pio_data = pixels;
+    pio_instruction = OP_STORE | (address << 3) | (1u << 20) | ((uint32_t)EXT_PACKED << 29);
+    enable_pulse();
+    return wait_result();
+}
+
+int ASM_Store_Block(unsigned int start_addr, const uint8_t *buf, size_t n) {
+    if (start_addr >= IMG_SIZE || n > IMG_SIZE - start_addr) {
+        return -1;
+    }
+    size_t i = 0;
+    for (; n - i >= 4; i += 4) {
+        uint32_t px = buf[i] | (buf[i + 1] << 8) | (buf[i + 2] << 16) | ((uint32_t)buf[i + 3] << 24);
+        if (ASM_Store_Packed(start_addr + i, px) != 0) {
+            return -3;
+        }
+    }
+    for (; i < n; i++) {
+        if (ASM_Store(start_addr + i, buf[i]) != 0) {
+            return -3;
+        }
+    }
+    return 0;
+}
+
+int ASM_Upload_Frame(const uint8_t *buf) {
+    if (!top || ((uintptr_t)buf & 3)) {
+        return -1;
+    }
+    uint64_t start = cycles;
+    for (uint32_t i = 0; i < IMG_SIZE; i += 4) {
+        vram_write(i, *(const uint32_t *)(buf + i), 0xF);
+    }
+    fprintf(stderr, "[sim] VRAM     %9llu ciclos (upload de %d bytes)\n",
+            (unsigned long long)(cycles - start), IMG_SIZE);
+    return 0;
+}
+
+int ASM_Load(unsigned int address, unsigned int sel_mem) {
+    if (address >= IMG_SIZE) {
+        return -1;
+    }
+    pio_instruction = OP_LOAD | (address << 3) | ((sel_mem & 1) << 20);
+    enable_pulse();
+    return top->FLAG_ERROR ? -3 : top->DATA_OUT;
+}
+
+int API_Read_Frame(int which_mem, uint8_t *buf) {
+    if (!top || which_mem < 0 || which_mem > 2 || ((uintptr_t)buf & 3)) {
+        return -1;
+    }
+    uint64_t start = cycles;
+    vram_read((uint32_t)which_mem << 17, buf, IMG_SIZE);
+    fprintf(stderr, "[sim] VRAM     %9llu ciclos (leitura da memória %d)\n",
+            (unsigned long long)(cycles - start), which_mem);
+    return 0;
+}
+
+/* ===================================================================
+ * api.h: DMA
+ * =================================================================== */
+
+void* API_Dma_Alloc(size_t size, uint32_t *phys) {
+    size_t rounded = (size + 0xFFF) & ~(size_t)0xFFF;
+
+    if (dma_pool.empty()) {
+        dma_pool.assign(DMA_POOL_SPAN, 0);
+    }
+    if (dma_pool_used + rounded > DMA_POOL_SPAN) {
+        return NULL;
+    }
+    if (phys) {
+        *phys = DMA_POOL_BASE + dma_pool_used;
+    }
+    void *ptr = &dma_pool[dma_pool_used];
+    dma_pool_used += rounded;
+    return ptr;
+}
+
+void API_Dma_Free_All(void) {
+    dma_pool_used = 0;
+}
+
+int ASM_Dma_Upload(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || n > IMG_SIZE) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_DMA << 29);
+    enable_pulse();
+    return 0;
+}
+
+int ASM_Dma_Upload_Rle(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || n > 0x1FFFF) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_RLE << 29);
+    enable_pulse();
+    return 0;
+}
+
+int ASM_Dma_Upload_Spans(uint32_t phys_addr, size_t n) {
+    if ((phys_addr & 31) || (n & 3) || n > 0x1FFFF) {
+        return -1;
+    }
+    pio_data = phys_addr;
+    pio_instruction = OP_STORE | ((uint32_t)n << 3) | ((uint32_t)EXT_SPANS << 29);
+    enable_pulse();
+    return 0;
+}
+
+/* ===================================================================
+ * api.h: Comandos e Algoritmos
+ * =================================================================== */
+
+void ASM_Refresh(void) {
+    pio_instruction = OP_REFRESH;
+    enable_pulse();
+}
+
+void ASM_Refresh_Vsync(void) {
+    // a espera pela troca anterior (até um quadro do VGA) entra nos ciclos do comando
+    pio_instruction = OP_REFRESH | ((uint32_t)EXT_VSYNC << 29);
+    enable_pulse();
+}
+
+void ASM_Pulse_Enable(void) {
+    enable_pulse();
+}
+
+void NearestNeighbor(void)  { pio_instruction = OP_NHI_ALG | alg_ext; }
+void PixelReplication(void) { pio_instruction = OP_PR_ALG | alg_ext; }
+void Decimation(void)       { pio_instruction = OP_NH_ALG | alg_ext; }
+void BlockAveraging(void)   { pio_instruction = OP_BA_ALG | alg_ext; }
+void BilinearZoom(void)     { pio_instruction = OP_NHI_ALG | ((uint32_t)EXT_BILINEAR << 29); }
+
+void API_Set_Scanout(int enable) {
+    alg_ext = enable ? (uint32_t)EXT_SCAN << 29 : 0;
+}
+
+int API_Zoom_To(unsigned int scale_q8) {
+    if (scale_q8 < ZOOM_SCALE_MIN || scale_q8 > ZOOM_SCALE_MAX) {
+        return -1;
+    }
+    pio_instruction = OP_REFRESH | (scale_q8 << 3) | ((uint32_t)EXT_SCALE << 29);
+    enable_pulse();
+    return 0;
+}
+
+int API_Set_Zoom(unsigned int level, unsigned int alg) {
+    if (level < ZOOM_LEVEL_MIN || level > ZOOM_LEVEL_MAX || alg > ZOOM_ALG_BILINEAR) {
+        return -1;
+    }
+    uint32_t arg = level | (alg << 3) | (alg_ext ? 0x20 : 0);
+    pio_instruction = OP_REFRESH | (arg << 3) | ((uint32_t)EXT_LEVEL << 29);
+    enable_pulse();
+    return 0;
+}
+
+void API_Set_Zoom_Cache(int enable) {
+    pio_instruction = OP_REFRESH | ((enable ? 1u : 0u) << 3) | ((uint32_t)EXT_CACHE << 29);
+    enable_pulse();
+}
+
+int API_Get_Zoom_Cache_Stats(uint32_t *hits, uint32_t *misses) {
+    PerfCounters p;
+    if (!hits || !misses || API_Read_Perf_Counters(&p) != 0) {
+        return -1;
+    }
+    *hits = p.zoom_cache_hits;
+    *misses = p.zoom_cache_misses;
+    return 0;
+}
+
+int API_Set_Zoom_Center(unsigned int x, unsigned int y) {
+    if (x >= IMG_WIDTH || y >= IMG_HEIGHT) {
+        return -1;
+    }
+    pio_instruction = OP_REFRESH | ((x | (y << 9)) << 3) | ((uint32_t)EXT_CENTER << 29);
+    enable_pulse();
+    return 0;
+}
+
+void ASM_Reset(void) {
+    pio_instruction = OP_RESET;
+    enable_pulse();
+}
+
+/* ===================================================================
+ * api.h: Interrupção e Flags
+ * =================================================================== */
+
+int API_Get_Irq_Fd(void) {
+    return -1; // sem /dev/uio0
+}
+
+int API_Irq_Rearm(void) {
+    return -1;
+}
+
+int API_Wait_Done(unsigned int timeout_us) {
+    (void)timeout_us;
+    // os comandos rodam até o fim dentro do pulso
+    return top->FLAG_ERROR ? -3 : 0;
+}
+
+/* ===================================================================
+ * api.h: Contadores de desempenho (lidos do próprio RTL)
+ * =================================================================== */
+
+static uint32_t perf_read(unsigned sel) {
+    top->PERF_SEL = sel;
+    for (int i = 0; i < 4; i++) { // sincronizador de 2 flops + registrador de saída
+        tick();
+    }
+    return top->PERF_DATA;
+}
+
+int API_Read_Perf_Counters(PerfCounters *out) {
+    if (!top || !out || perf_read(0) != 0x50455246u) {
+        return -1;
+    }
+    uint32_t words[24];
+    for (unsigned sel = 1; sel <= 24; sel++) {
+        words[sel - 1] = perf_read(sel);
+    }
+    perf_read(0);
+    memcpy(out, words, sizeof(words));
+    return 0;
+}
+
+int ASM_Get_Flag_Done(void)     { return top->FLAG_DONE; }
+int ASM_Get_Flag_Error(void)    { return top->FLAG_ERROR; }
+int ASM_Get_Flag_Max_Zoom(void) { return top->FLAG_ZOOM_MAX; }
+int ASM_Get_Flag_Min_Zoom(void) { return top->FLAG_ZOOM_MIN; }
@@ -0,0 +1,346 @@
+/*
+ * =========================================================================
+ * stream.c: Vídeo Contínuo na VGA (troca de página no vsync)
+ * =========================================================================
+ *
+ * Lê quadros crus de 320x240 (1 byte por pixel, um atrás do outro) de um
+ * arquivo, de um FIFO ou da entrada padrão e os exibe na taxa pedida:
+ *
+ *  - uma thread leitora preenche um anel de quadros alocado no início
+ *    (nenhuma alocação por quadro); com o anel cheio ela espera;
+ *  - a thread principal envia cada quadro para a mem1 (delta_upload) e
+ *    pede a troca no próximo vsync (ASM_Refresh_Vsync). O FLAG_DONE vem
+ *    com o quadro já no buffer de trás, então o próximo envio começa
+ *    enquanto ele espera o vsync: um quadro em voo, sem tearing;
+ *  - se o envio atrasa mais de um período e já há quadro mais novo no
+ *    anel, o atrasado é descartado para alcançar o relógio.
+ *
+ * No fim (ou no Ctrl+C) imprime em stderr a taxa alcançada, os quadros
+ * descartados e, com os contadores de desempenho, os vsyncs em que a
+ * tela repetiu o quadro anterior.
+ *
+ * Uso: ./stream [-r fps] [-b quadros] [-n máximo] [-l] [arquivo | -]
+ *      (-r 0 = o mais rápido possível; -l repete o arquivo)
+ *
+ * Compilar com -pthread (make stream / make stream_emu).
+ *
+ */
+
+#define _DEFAULT_SOURCE
+#include "api.h"
+#include "delta.h"
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#define DEFAULT_FPS     30
+#define DEFAULT_RING    4
+#define MAX_RING        16
+#define WAIT_TIMEOUT_US 5000000
+
+typedef struct {
+    FILE *in;
+    int loop;                 // -l: volta ao início do arquivo no fim
+    int ring;
+
+    uint8_t *frames;          // ring * IMG_SIZE, alocado uma vez
+    int head, tail, filled;   // leitora escreve em head, exibição lê em tail
+    int eof;                  // a leitora terminou (fim da entrada ou erro)
+    int stop;
+
+    pthread_mutex_t lock;
+    pthread_cond_t  not_full, not_empty;
+
+    uint32_t frames_read;
+} Stream;
+
+typedef struct {
+    uint32_t shown;           // quadros enviados e trocados no vsync
+    uint32_t dropped;         // quadros descartados por atraso
+    uint32_t failed;          // envios com erro
+    double   wall_ms;
+    double   upload_ms, upload_max_ms;   // delta_upload + cópia para o buffer de trás
+    double   starved_ms;      // esperando a entrada (a fonte é o gargalo)
+    uint64_t bus_bytes;
+} StreamStats;
+
+static volatile sig_atomic_t interrupted;
+
+static void on_sigint(int sig) {
+    (void)sig;
+    interrupted = 1;
+}
+
+static double now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static void sleep_until_ms(double deadline) {
+    long long ns = (long long)((deadline - now_ms()) * 1e6);
+    if (ns > 0) {
+        struct timespec t = {(time_t)(ns / 1000000000), (long)(ns % 1000000000)};
+        nanosleep(&t, NULL);
+    }
+}
+
+// Espera o FLAG_DONE: interrupção se houver, senão polling
+static int wait_done(void) {
+    int status = API_Wait_Done(WAIT_TIMEOUT_US);
+    if (status == -1) {
+        double limit = now_ms() + WAIT_TIMEOUT_US / 1e3;
+        while (!ASM_Get_Flag_Done()) {
+            if (now_ms() > limit) {
+                return -2;
+            }
+        }
+        status = ASM_Get_Flag_Error() ? -3 : 0;
+    }
+    return status;
+}
+
+/* ===================================================================
+ * Thread leitora
+ * =================================================================== */
+
+// Lê um quadro inteiro; 0 no sucesso, -1 no fim da entrada
+static int read_frame(Stream *s, uint8_t *dst) {
+    size_t got = fread(dst, 1, IMG_SIZE, s->in);
+    if (got == IMG_SIZE) {
+        return 0;
+    }
+    if (got == 0 && s->loop && s->frames_read > 0 && fseek(s->in, 0, SEEK_SET) == 0) {
+        return fread(dst, 1, IMG_SIZE, s->in) == IMG_SIZE ? 0 : -1;
+    }
+    if (got != 0) {
+        fprintf(stderr, "Aviso: quadro incompleto no fim da entrada (%zu bytes) ignorado\n", got);
+    }
+    return -1;
+}
+
+static void *reader(void *arg) {
+    Stream *s = arg;
+
+    for (;;) {
+        pthread_mutex_lock(&s->lock);
+        while (s->filled == s->ring && !s->stop) {
+            pthread_cond_wait(&s->not_full, &s->lock);
+        }
+        int stop = s->stop;
+        int slot = s->head;
+        pthread_mutex_unlock(&s->lock);
+        if (stop) {
+            break;
+        }
+
+        // o slot só volta a ser do consumidor depois do filled++
+        if (read_frame(s, s->frames + (size_t)slot * IMG_SIZE) != 0) {
+            break;
+        }
+        s->frames_read++;
+
+        pthread_mutex_lock(&s->lock);
+        s->head = (slot + 1) % s->ring;
+        s->filled++;
+        pthread_cond_signal(&s->not_empty);
+        pthread_mutex_unlock(&s->lock);
+    }
+
+    pthread_mutex_lock(&s->lock);
+    s->eof = 1;
+    pthread_cond_signal(&s->not_empty);
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+/* ===================================================================
+ * Exibição
+ * =================================================================== */
+
+static int show_frame(const uint8_t *frame, StreamStats *st) {
+    DeltaStats ds;
+    double t0 = now_ms();
+    int status = delta_upload(frame, &ds);
+    if (status == 0) {
+        ASM_Refresh_Vsync();
+        status = wait_done();
+    }
+    double dt = now_ms() - t0;
+    st->upload_ms += dt;
+    if (dt > st->upload_max_ms) {
+        st->upload_max_ms = dt;
+    }
+    st->bus_bytes += ds.bus_bytes;
+    return status;
+}
+
+static void stream_run(Stream *s, double fps, uint32_t max_frames, StreamStats *st) {
+    double period = fps > 0 ? 1e3 / fps : 0;
+    double start = now_ms();
+    double due = start;       // horário de exibição do próximo quadro
+
+    while (!interrupted && (max_frames == 0 || st->shown + st->dropped < max_frames)) {
+        double t0 = now_ms();
+        pthread_mutex_lock(&s->lock);
+        while (s->filled == 0 && !s->eof) {
+            pthread_cond_wait(&s->not_empty, &s->lock);
+        }
+        if (s->filled == 0) {
+            pthread_mutex_unlock(&s->lock);
+            break; // fim da entrada
+        }
+        int slot = s->tail;
+        int newer = s->filled > 1;
+        pthread_mutex_unlock(&s->lock);
+
+        double t1 = now_ms();
+        st->starved_ms += t1 - t0;
+        if (t1 - t0 > 1.0 && t1 > due) {
+            due = t1; // a fonte atrasou, não a exibição: recomeça o relógio
+        }
+
+        if (period > 0 && t1 > due + period && newer) {
+            st->dropped++;
+        } else {
+            sleep_until_ms(due);
+            if (show_frame(s->frames + (size_t)slot * IMG_SIZE, st) == 0) {
+                st->shown++;
+            } else {
+                st->failed++;
+            }
+        }
+        due += period;
+
+        pthread_mutex_lock(&s->lock);
+        s->tail = (slot + 1) % s->ring;
+        s->filled--;
+        pthread_cond_signal(&s->not_full);
+        pthread_mutex_unlock(&s->lock);
+    }
+    st->wall_ms = now_ms() - start;
+
+    pthread_mutex_lock(&s->lock);
+    s->stop = 1;
+    pthread_cond_signal(&s->not_full);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static void print_report(const StreamStats *st, double fps, const PerfCounters *p0, const PerfCounters *p1) {
+    uint32_t handled = st->shown + st->failed;
+    double secs = st->wall_ms / 1e3;
+
+    fprintf(stderr, "\n--- Streaming ---\n");
+    fprintf(stderr, "  Quadros exibidos: %u em %.2f s (%.1f fps", st->shown, secs,
+            secs > 0 ? st->shown / secs : 0.0);
+    if (fps > 0) {
+        fprintf(stderr, ", alvo %.1f", fps);
+    }
+    fprintf(stderr, ")\n");
+    fprintf(stderr, "  Descartados por atraso: %u\n", st->dropped);
+    if (st->failed) {
+        fprintf(stderr, "  Envios com erro: %u\n", st->failed);
+    }
+    if (handled) {
+        fprintf(stderr, "  Envio + cópia: média %.2f ms, pior %.2f ms, %.1f KB/quadro na ponte\n",
+                st->upload_ms / handled, st->upload_max_ms, st->bus_bytes / 1024.0 / handled);
+    }
+    fprintf(stderr, "  Esperando a entrada: %.1f ms\n", st->starved_ms);
+    if (p0 && p1) {
+        uint32_t vsyncs = p1->vsyncs - p0->vsyncs;
+        uint32_t flips = p1->flips - p0->flips;
+        fprintf(stderr, "  VGA: %u vsyncs, %u trocas (%u vsyncs repetiram o quadro)\n",
+                vsyncs, flips, vsyncs > flips ? vsyncs - flips : 0);
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Uso: %s [-r fps] [-b quadros] [-n máximo] [-l] [arquivo | -]\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    double fps = DEFAULT_FPS;
+    int ring = DEFAULT_RING;
+    uint32_t max_frames = 0;
+    int loop = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:b:n:lh")) != -1) {
+        switch (opt) {
+            case 'r':
+                fps = atof(optarg);
+                break;
+            case 'b':
+                ring = atoi(optarg);
+                break;
+            case 'n':
+                max_frames = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'l':
+                loop = 1;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (fps < 0 || ring < 2 || ring > MAX_RING) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    Stream s;
+    memset(&s, 0, sizeof(s));
+    s.ring = ring;
+    s.loop = loop;
+    s.in = stdin;
+    if (optind < argc && strcmp(argv[optind], "-") != 0 && !(s.in = fopen(argv[optind], "rb"))) {
+        fprintf(stderr, "Erro ao abrir '%s'\n", argv[optind]);
+        return 1;
+    }
+    s.frames = malloc((size_t)ring * IMG_SIZE);
+    if (!s.frames) {
+        fprintf(stderr, "Erro: sem memória para %d quadros\n", ring);
+        return 1;
+    }
+
+    volatile void *base = API_initialize();
+    if (base == NULL || base == (void *)INIT_ERR_OPEN || base == (void *)INIT_ERR_MMAP) {
+        fprintf(stderr, "Erro: API_initialize falhou\n");
+        free(s.frames);
+        return 1;
+    }
+
+    pthread_mutex_init(&s.lock, NULL);
+    pthread_cond_init(&s.not_full, NULL);
+    pthread_cond_init(&s.not_empty, NULL);
+    signal(SIGINT, on_sigint);
+
+    StreamStats st;
+    PerfCounters perf0, perf1;
+    pthread_t thread;
+    int have_perf = (API_Read_Perf_Counters(&perf0) == 0);
+    int result = 0;
+
+    memset(&st, 0, sizeof(st));
+    if (pthread_create(&thread, NULL, reader, &s) != 0) {
+        fprintf(stderr, "Erro: não foi possível criar a thread leitora\n");
+        result = 1;
+    } else {
+        stream_run(&s, fps, max_frames, &st);
+        // a leitora pode estar presa num fread de FIFO: não espera por ela
+        pthread_detach(thread);
+        have_perf = have_perf && API_Read_Perf_Counters(&perf1) == 0;
+        print_report(&st, fps, have_perf ? &perf0 : NULL, have_perf ? &perf1 : NULL);
+        result = st.failed ? 1 : 0;
+    }
+
+    delta_close();
+    API_close();
+    return result;
+}
@@ -0,0 +1,390 @@
+/*
+ * =========================================================================
+ * zoom_sw.hpp: Zoom por Software no HPS (NEON)
+ * =========================================================================
+ *
+ * Os quatro algoritmos do FPGA em C++ para rodar no ARM, como reserva
+ * quando o FPGA não está disponível e para imagens maiores que 320x240:
+ *   nearest_neighbor<F>, pixel_replication<F>  zoom in (NHI / PR)
+ *   decimation<F>, block_averaging<F>           zoom out (NH / BA)
+ *
+ * O fator F (2, 4 ou 8) é parâmetro do template: os deslocamentos, o
+ * tamanho dos blocos e os laços internos saem resolvidos na compilação.
+ * Com __ARM_NEON os laços internos usam intrínsecos (vzip, vld2/vld4,
+ * somas em pares); sem NEON, o mesmo código roda com os laços escalares
+ * (a média de blocos soma pares de pixels em palavras de 32 bits).
+ * zoom_sw::scalar tem as versões ingênuas, pixel a pixel, usadas como
+ * referência e base de comparação no zoom_sw_bench.
+ *
+ * A vista é a mesma do main.v, com W x H no lugar de 320 x 240:
+ *   zoom in:  janela de (W >> s) x (H >> s) centrada em (cx, cy), recortada
+ *             para dentro da imagem (coluna par no 2x)
+ *   zoom out: a imagem reduzida começa em ((W/2 - (cx >> s)) & ~3,
+ *             H/2 - (cy >> s)); fora dela a saída é zero
+ * Com W = 320 e H = 240 a saída é idêntica à do FPGA (e à do emu.c).
+ *
+ * Requisitos: W e H múltiplos de 8, 0 <= cx < W, 0 <= cy < H, e src e dst
+ * com W * H bytes sem sobreposição.
+ *
+ * #include "zoom_sw.hpp"
+ *
+ */
+
+#ifndef ZOOM_SW_HPP_
+#define ZOOM_SW_HPP_
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace zoom_sw {
+
+enum Algorithm {
+    NEAREST_NEIGHBOR  = 0,
+    PIXEL_REPLICATION = 1,
+    DECIMATION        = 2,
+    BLOCK_AVERAGING   = 3
+};
+
+// log2 do fator (só 2, 4 e 8, como no FPGA)
+template <unsigned F>
+struct Factor {
+    static_assert(F == 2 || F == 4 || F == 8, "fator de zoom deve ser 2, 4 ou 8");
+    static const unsigned shift = (F == 2) ? 1 : (F == 4) ? 2 : 3;
+};
+
+/* ===================================================================
+ * Vista (a mesma do main.v)
+ * =================================================================== */
+
+// Origem da janela de origem no zoom in
+template <unsigned F>
+inline void view_in(unsigned w, unsigned h, unsigned cx, unsigned cy, unsigned *vx, unsigned *vy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned hx = (w / 2) >> s, hy = (h / 2) >> s;
+    unsigned mx = w - (w >> s), my = h - (h >> s);
+    *vx = cx < hx ? 0 : cx - hx > mx ? mx : cx - hx;
+    *vy = cy < hy ? 0 : cy - hy > my ? my : cy - hy;
+    if (F == 2) {
+        *vx &= ~1u;
+    }
+}
+
+// Canto da imagem reduzida na tela no zoom out
+template <unsigned F>
+inline void view_out(unsigned w, unsigned h, unsigned cx, unsigned cy, unsigned *vx, unsigned *vy) {
+    const unsigned s = Factor<F>::shift;
+    *vx = (w / 2 - (cx >> s)) & ~3u;
+    *vy = h / 2 - (cy >> s);
+}
+
+/* ===================================================================
+ * Laços internos: uma linha de saída
+ * =================================================================== */
+
+namespace detail {
+
+#ifdef __ARM_NEON
+// Grava 8 pixels repetidos F vezes cada (8F bytes): vzip do vetor consigo
+// mesmo dobra cada pixel; F = 4 e 8 repetem o passo nas metades
+template <unsigned F>
+struct Replicate {
+    static inline void store(uint8x8_t v, uint8_t *d) {
+        uint8x8x2_t z = vzip_u8(v, v);
+        Replicate<F / 2>::store(z.val[0], d);
+        Replicate<F / 2>::store(z.val[1], d + 4 * F);
+    }
+};
+
+template <>
+struct Replicate<1> {
+    static inline void store(uint8x8_t v, uint8_t *d) { vst1_u8(d, v); }
+};
+
+// Somas horizontais de 8 blocos de F pixels consecutivos (8F bytes)
+template <unsigned F>
+struct RowSum {
+    static inline uint16x8_t load(const uint8_t *p) {
+        uint16x8_t a = RowSum<F / 2>::load(p);
+        uint16x8_t b = RowSum<F / 2>::load(p + 4 * F);
+        return vcombine_u16(vpadd_u16(vget_low_u16(a), vget_high_u16(a)),
+                            vpadd_u16(vget_low_u16(b), vget_high_u16(b)));
+    }
+};
+
+template <>
+struct RowSum<2> {
+    static inline uint16x8_t load(const uint8_t *p) { return vpaddlq_u8(vld1q_u8(p)); }
+};
+#endif
+
+// n pixels de saída, cada pixel de s repetido F vezes
+template <unsigned F>
+inline void replicate_row(const uint8_t *s, uint8_t *d, unsigned n) {
+    unsigned x = 0;
+#ifdef __ARM_NEON
+    for (; x + 8 * F <= n; x += 8 * F) {
+        Replicate<F>::store(vld1_u8(s + x / F), d + x);
+    }
+#endif
+    for (; x < n; x++) {
+        d[x] = s[x / F];
+    }
+}
+
+// n pixels de saída, um a cada F de s
+template <unsigned F>
+inline void decimate_row(const uint8_t *s, uint8_t *d, unsigned n) {
+    unsigned x = 0;
+#ifdef __ARM_NEON
+    for (; x + 16 <= n; x += 16) {
+        const uint8_t *p = s + x * F;
+        if (F == 2) {
+            vst1q_u8(d + x, vld2q_u8(p).val[0]);
+        } else if (F == 4) {
+            vst1q_u8(d + x, vld4q_u8(p).val[0]);
+        } else {
+            // um a cada 4 de 128 bytes, depois só os pares
+            uint8x16x2_t u = vuzpq_u8(vld4q_u8(p).val[0], vld4q_u8(p + 64).val[0]);
+            vst1q_u8(d + x, u.val[0]);
+        }
+    }
+#endif
+    for (; x < n; x++) {
+        d[x] = s[x * F];
+    }
+}
+
+// n pixels de saída, média (truncada) dos blocos F x F de s (linhas de w bytes)
+template <unsigned F>
+inline void average_row(const uint8_t *s, unsigned w, uint8_t *d, unsigned n) {
+    const unsigned s2 = 2 * Factor<F>::shift;
+    unsigned x = 0;
+#ifdef __ARM_NEON
+    for (; x + 8 <= n; x += 8) {
+        const uint8_t *p = s + x * F;
+        uint16x8_t acc = RowSum<F>::load(p);
+        for (unsigned j = 1; j < F; j++) {
+            acc = vaddq_u16(acc, RowSum<F>::load(p + j * w));
+        }
+        // soma máxima 64 * 255, cabe nos 16 bits
+        vst1_u8(d + x, vshrn_n_u16(acc, s2));
+    }
+#else
+    // Sem NEON, somas em paralelo numa palavra de 32 bits: cada palavra de
+    // 4 pixels vira duas somas de pares, uma em cada metade de 16 bits
+    // (soma máxima 8 * F * 255, cabe). 4 / F pixels de saída por palavra
+    // no 2x e no 4x; 2 palavras por linha do bloco no 8x
+    const unsigned words = (F == 8) ? 2 : 1;
+    const unsigned step = (F == 2) ? 2 : 1;
+    for (; x + step <= n; x += step) {
+        const uint8_t *p = s + x * F;
+        uint32_t acc = 0;
+        for (unsigned j = 0; j < F; j++) {
+            for (unsigned k = 0; k < words; k++) {
+                uint32_t v;
+                memcpy(&v, p + j * w + 4 * k, 4);
+                acc += (v & 0x00FF00FFu) + ((v >> 8) & 0x00FF00FFu);
+            }
+        }
+        if (F == 2) {
+            d[x]     = (uint8_t)((acc & 0xFFFFu) >> s2);
+            d[x + 1] = (uint8_t)((acc >> 16) >> s2);
+        } else {
+            d[x] = (uint8_t)(((acc & 0xFFFFu) + (acc >> 16)) >> s2);
+        }
+    }
+#endif
+    for (; x < n; x++) {
+        const uint8_t *p = s + x * F;
+        unsigned sum = 0;
+        for (unsigned j = 0; j < F; j++) {
+            for (unsigned i = 0; i < F; i++) {
+                sum += p[j * w + i];
+            }
+        }
+        d[x] = (uint8_t)(sum >> s2);
+    }
+}
+
+// Zoom out: linhas da imagem reduzida na vista, zero em volta
+template <unsigned F, bool Average>
+inline void zoom_out(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned vx, vy;
+    view_out<F>(w, h, cx, cy, &vx, &vy);
+    unsigned ow = w >> s, oh = h >> s;
+
+    memset(dst, 0, (size_t)w * vy);
+    for (unsigned y = 0; y < oh; y++) {
+        uint8_t *d = dst + (size_t)(vy + y) * w;
+        const uint8_t *p = src + (size_t)(y << s) * w;
+        memset(d, 0, vx);
+        if (Average) {
+            average_row<F>(p, w, d + vx, ow);
+        } else {
+            decimate_row<F>(p, d + vx, ow);
+        }
+        memset(d + vx + ow, 0, w - vx - ow);
+    }
+    memset(dst + (size_t)(vy + oh) * w, 0, (size_t)w * (h - vy - oh));
+}
+
+} // namespace detail
+
+/* ===================================================================
+ * Kernels
+ * =================================================================== */
+
+/**
+ * @brief Zoom in F vezes por vizinho mais próximo (NHI): cada linha de
+ * saída é montada uma vez e copiada para as F - 1 seguintes.
+ */
+template <unsigned F>
+inline void nearest_neighbor(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned vx, vy;
+    view_in<F>(w, h, cx, cy, &vx, &vy);
+    for (unsigned y = 0; y < h; y += F) {
+        uint8_t *d = dst + (size_t)y * w;
+        detail::replicate_row<F>(src + (size_t)(vy + (y >> s)) * w + vx, d, w);
+        for (unsigned j = 1; j < F; j++) {
+            memcpy(d + (size_t)j * w, d, w);
+        }
+    }
+}
+
+/**
+ * @brief Zoom in F vezes por replicação de pixel (PR). No FPGA, para
+ * fatores inteiros, dá o mesmo resultado do vizinho mais próximo.
+ */
+template <unsigned F>
+inline void pixel_replication(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    nearest_neighbor<F>(src, dst, w, h, cx, cy);
+}
+
+/**
+ * @brief Zoom out F vezes por decimação (NH): um pixel a cada F.
+ */
+template <unsigned F>
+inline void decimation(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    detail::zoom_out<F, false>(src, dst, w, h, cx, cy);
+}
+
+/**
+ * @brief Zoom out F vezes pela média (truncada) de cada bloco F x F (BA).
+ */
+template <unsigned F>
+inline void block_averaging(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    detail::zoom_out<F, true>(src, dst, w, h, cx, cy);
+}
+
+/* ===================================================================
+ * Referência: laços ingênuos, um pixel de saída por vez
+ * =================================================================== */
+
+namespace scalar {
+
+template <unsigned F>
+inline void nearest_neighbor(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned vx, vy;
+    view_in<F>(w, h, cx, cy, &vx, &vy);
+    for (unsigned y = 0; y < h; y++) {
+        for (unsigned x = 0; x < w; x++) {
+            dst[y * w + x] = src[(vy + (y >> s)) * w + vx + (x >> s)];
+        }
+    }
+}
+
+template <unsigned F>
+inline void pixel_replication(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    nearest_neighbor<F>(src, dst, w, h, cx, cy);
+}
+
+template <unsigned F>
+inline void decimation(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned vx, vy;
+    view_out<F>(w, h, cx, cy, &vx, &vy);
+    for (unsigned y = 0; y < h; y++) {
+        for (unsigned x = 0; x < w; x++) {
+            uint8_t px = 0;
+            if (x >= vx && x < vx + (w >> s) && y >= vy && y < vy + (h >> s)) {
+                px = src[((y - vy) << s) * w + ((x - vx) << s)];
+            }
+            dst[y * w + x] = px;
+        }
+    }
+}
+
+template <unsigned F>
+inline void block_averaging(const uint8_t *src, uint8_t *dst, unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    const unsigned s = Factor<F>::shift;
+    unsigned vx, vy;
+    view_out<F>(w, h, cx, cy, &vx, &vy);
+    for (unsigned y = 0; y < h; y++) {
+        for (unsigned x = 0; x < w; x++) {
+            uint8_t px = 0;
+            if (x >= vx && x < vx + (w >> s) && y >= vy && y < vy + (h >> s)) {
+                unsigned base = ((y - vy) << s) * w + ((x - vx) << s), sum = 0;
+                for (unsigned j = 0; j < F; j++) {
+                    for (unsigned i = 0; i < F; i++) {
+                        sum += src[base + j * w + i];
+                    }
+                }
+                px = (uint8_t)(sum >> (2 * s));
+            }
+            dst[y * w + x] = px;
+        }
+    }
+}
+
+} // namespace scalar
+
+/* ===================================================================
+ * Escolha em tempo de execução
+ * =================================================================== */
+
+typedef void (*Kernel)(const uint8_t *, uint8_t *, unsigned, unsigned, unsigned, unsigned);
+
+// Kernel do algoritmo e fator pedidos (otimizado ou ingênuo), ou 0 se inválidos
+inline Kernel kernel(int alg, unsigned factor, bool naive = false) {
+#define ZOOM_SW_PICK(f)                                                                                 \
+    switch (alg) {                                                                                      \
+        case NEAREST_NEIGHBOR:  return naive ? scalar::nearest_neighbor<f>  : nearest_neighbor<f>;       \
+        case PIXEL_REPLICATION: return naive ? scalar::pixel_replication<f> : pixel_replication<f>;      \
+        case DECIMATION:        return naive ? scalar::decimation<f>        : decimation<f>;             \
+        case BLOCK_AVERAGING:   return naive ? scalar::block_averaging<f>   : block_averaging<f>;        \
+        default:                return 0;                                                                \
+    }
+    switch (factor) {
+        case 2: ZOOM_SW_PICK(2)
+        case 4: ZOOM_SW_PICK(4)
+        case 8: ZOOM_SW_PICK(8)
+        default: return 0;
+    }
+#undef ZOOM_SW_PICK
+}
+
+/**
+ * @brief Aplica o zoom com o algoritmo e o fator dados em tempo de execução.
+ * @return 0 em sucesso, -1 se o algoritmo, o fator, o tamanho ou o centro
+ * forem inválidos.
+ */
+inline int zoom(int alg, unsigned factor, const uint8_t *src, uint8_t *dst,
+                unsigned w, unsigned h, unsigned cx, unsigned cy) {
+    Kernel k = kernel(alg, factor);
+    if (!k || !src || !dst || w == 0 || h == 0 || w % 8 || h % 8 || cx >= w || cy >= h) {
+        return -1;
+    }
+    k(src, dst, w, h, cx, cy);
+    return 0;
+}
+
+} // namespace zoom_sw
+
+#endif